@@ -0,0 +1,83 @@
+/*
+Copyright 1989, 1998  The Open Group
+
+Permission to use, copy, modify, distribute, and sell this software and its
+documentation for any purpose is hereby granted without fee, provided that
+the above copyright notice appear in all copies and that both that
+copyright notice and this permission notice appear in supporting
+documentation.
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+OPEN GROUP BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+Except as contained in this notice, the name of The Open Group shall not be
+used in advertising or otherwise to promote the sale, use or other dealings
+in this Software without prior written authorization from The Open Group.
+ */
+
+#ifndef _MULTIBUFCONST_H_
+#define _MULTIBUFCONST_H_
+
+#define MULTIBUFFER_PROTOCOL_NAME "Multi-Buffering"
+
+#define MULTIBUFFER_MAJOR_VERSION	1	/* current version numbers */
+#define MULTIBUFFER_MINOR_VERSION	1	/* has ClearImageBufferArea */
+
+/*
+ * update_action field
+ */
+#define MultibufferUpdateActionUndefined	0
+#define MultibufferUpdateActionBackground	1
+#define MultibufferUpdateActionUntouched	2
+#define MultibufferUpdateActionCopied		3
+
+/*
+ * update_hint field
+ */
+#define MultibufferUpdateHintFrequent		0
+#define MultibufferUpdateHintIntermittent	1
+#define MultibufferUpdateHintStatic		2
+
+/*
+ * valuemask fields
+ */
+#define MultibufferWindowUpdateHint	(1L << 0)
+#define MultibufferBufferEventMask	(1L << 0)
+
+/*
+ * mono vs. stereo and left vs. right
+ */
+#define MultibufferModeMono		0
+#define MultibufferModeStereo		1
+#define MultibufferSideMono		0
+#define MultibufferSideLeft	  	1
+#define MultibufferSideRight		2
+
+/*
+ * clobber state
+ */
+#define MultibufferUnclobbered		0
+#define MultibufferPartiallyClobbered	1
+#define MultibufferFullyClobbered	2
+
+/*
+ * event stuff
+ */
+#define MultibufferClobberNotifyMask	0x02000000
+#define MultibufferUpdateNotifyMask	0x04000000
+
+#define MultibufferClobberNotify	0
+#define MultibufferUpdateNotify		1
+#define MultibufferNumberEvents		(MultibufferUpdateNotify + 1)
+
+#define MultibufferBadBuffer		0
+#define MultibufferNumberErrors		(MultibufferBadBuffer + 1)
+
+#endif /* _MULTIBUFCONST_H_ */
@@ -0,0 +1,3 @@
+#warning "xcmiscstr.h is obsolete and may be removed in the future."
+#warning "include <X11/extensions/xcmiscproto.h> for the protocol defines."
+#include <X11/extensions/xcmiscproto.h>
@@ -0,0 +1,20 @@
+/*
+ * Declarations for the BIGFONT extension.
+ *
+ * Copyright (c) 1999-2000  Bruno Haible
+ * Copyright (c) 1999-2000  The XFree86 Project, Inc.
+ */
+
+/* THIS IS NOT AN X CONSORTIUM STANDARD */
+
+#ifndef _XF86BIGFONT_H_
+#define _XF86BIGFONT_H_
+
+#define X_XF86BigfontQueryVersion	0
+#define X_XF86BigfontQueryFont		1
+
+#define XF86BigfontNumberEvents		0
+
+#define XF86BigfontNumberErrors		0
+
+#endif /* _XF86BIGFONT_H_ */
@@ -0,0 +1,36 @@
+/*
+
+Copyright (c) 1995  Jon Tombs
+Copyright (c) 1995  XFree86 Inc
+
+*/
+
+/************************************************************************
+
+   THIS IS THE OLD DGA API AND IS OBSOLETE.  PLEASE DO NOT USE IT ANYMORE
+
+************************************************************************/
+
+#ifndef _XF86DGA1CONST_H_
+#define _XF86DGA1CONST_H_
+
+#define X_XF86DGAQueryVersion		0
+#define X_XF86DGAGetVideoLL		1
+#define X_XF86DGADirectVideo		2
+#define X_XF86DGAGetViewPortSize	3
+#define X_XF86DGASetViewPort		4
+#define X_XF86DGAGetVidPage		5
+#define X_XF86DGASetVidPage		6
+#define X_XF86DGAInstallColormap	7
+#define X_XF86DGAQueryDirectVideo	8
+#define X_XF86DGAViewPortChanged	9
+
+#define XF86DGADirectPresent		0x0001
+#define XF86DGADirectGraphics		0x0002
+#define XF86DGADirectMouse		0x0004
+#define XF86DGADirectKeyb		0x0008
+#define XF86DGAHasColormap		0x0100
+#define XF86DGADirectColormap		0x0200
+
+
+#endif /* _XF86DGA1CONST_H_ */
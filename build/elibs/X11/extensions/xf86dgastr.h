@@ -0,0 +1,3 @@
+#warning "xf86dgastr.h is obsolete and may be removed in the future."
+#warning "include <X11/extensions/xf86dgaproto.h> for the protocol defines."
+#include <X11/extensions/xf86dgaproto.h>
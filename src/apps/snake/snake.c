@@ -4,6 +4,7 @@
 #include "assert.h"
 #include "snake_move.h"
 #include "snake_reward.h"
+#include "meta_serialize.h"
 
 struct snake {
     position reward;
@@ -26,6 +27,45 @@ struct snake {
     void* end;
 };
 
+// Snapshot layout, the end pointer is rebuilt on restore
+STATIC_ASSERT(sizeof(snake_direction) == sizeof(i32));
+
+static const field_descriptor position_fields[] = {
+    {STR("x"), offsetof(position, x), &i32_meta},
+    {STR("y"), offsetof(position, y), &i32_meta},
+};
+
+static const meta position_meta = {
+    .type_name = STR("position"),
+    .type_size = sizeof(position),
+    .pt = PT_NONE,
+    .fields = {RANGE(position_fields)},
+};
+
+static const meta position_array_meta = {
+    .type_size = sizeof(((snake*)0)->player_cells),
+    .pt = PT_ARRAY,
+    .array_element_meta = &position_meta,
+};
+
+static const field_descriptor snake_fields[] = {
+    {STR("reward"), offsetof(snake, reward), &position_meta},
+    {STR("grid_width"), offsetof(snake, grid_width), &i32_meta},
+    {STR("grid_height"), offsetof(snake, grid_height), &i32_meta},
+    {STR("time_accum_us"), offsetof(snake, time_accum_us), &u64_meta},
+    {STR("delta_time_between_movement"), offsetof(snake, delta_time_between_movement), &u64_meta},
+    {STR("player_cells"), offsetof(snake, player_cells), &position_array_meta},
+    {STR("player_direction"), offsetof(snake, player_direction), &i32_meta},
+    {STR("player_direction_on_next_update"), offsetof(snake, player_direction_on_next_update), &i32_meta},
+};
+
+static const meta snake_meta = {
+    .type_name = STR("snake"),
+    .type_size = sizeof(snake),
+    .pt = PT_NONE,
+    .fields = {RANGE(snake_fields)},
+};
+
 snake* snake_init(stack_alloc* alloc) {
     snake* s = sa_alloc(alloc, sizeof(*s));
     s->grid_width = 20;
@@ -132,12 +172,27 @@ snake_update_result snake_update(snake* s, snake_input input, u64 frame_us, stac
         position cand = generate_next_reward_position(s->reward, s->player_cells.begin, s->player_cells.end,
             s->grid_width, s->grid_height);
         s->reward =  ensure_reward_position_not_on_player(cand, s->player_cells.begin, s->player_cells.end,
-            s->grid_width, s->grid_height);
+            s->grid_width, s->grid_height, alloc);
     }
 
     return SNAKE_UPDATE_CONTINUE;
 }
 
+u8* snake_snapshot(snake* s, stack_alloc* alloc) {
+    return meta_serialize(alloc, &snake_meta, s);
+}
+
+snake* snake_restore(stack_alloc* alloc, const u8* begin, const u8* end) {
+    snake* s = sa_alloc(alloc, sizeof(*s));
+    // The player cells are allocated right after the snake, as in snake_init
+    if (!meta_deserialize(alloc, &snake_meta, begin, end, s)) {
+        sa_free(alloc, s);
+        return 0;
+    }
+    s->end = alloc->cursor;
+    return s;
+}
+
 /* Accessor implementations */
 
 i32 snake_get_grid_width(snake* s) {
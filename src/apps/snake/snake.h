@@ -28,6 +28,11 @@ typedef enum {
 
 snake_update_result snake_update(snake* s, snake_input input, u64 frame_us, stack_alloc* alloc);
 
+// Binary copy of the game state, allocated from alloc (end is alloc->cursor).
+u8* snake_snapshot(snake* s, stack_alloc* alloc);
+// Recreate a snake from a snapshot, with the same layout as snake_init. Returns 0 if the snapshot is truncated.
+snake* snake_restore(stack_alloc* alloc, const u8* begin, const u8* end);
+
 /* Accessors for opaque snake state (used by renderer and other modules). */
 i32 snake_get_grid_width(snake* s);
 i32 snake_get_grid_height(snake* s);
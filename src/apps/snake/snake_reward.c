@@ -1,11 +1,12 @@
 #include "snake_reward.h"
+#include "hash_map.h"
 
-static u8 position_on_player(position p, position* begin, position* end) {
-    u8 coll = 0;
-    for (position* cell = begin; cell < end; ++cell) {
-        if (snake_grid_equals(*cell, p)) { coll = 1; break; }
-    }
-    return coll;
+static u64 position_key(position p) {
+    return ((u64)(u32)p.x << 32) | (u64)(u32)p.y;
+}
+
+static u8 position_on_player(position p, hash_map* player_cells) {
+    return hash_map_find_u64(player_cells, position_key(p)) != 0;
 }
 
 position generate_next_reward_position(position current_reward, position* player_begin, position* player_end, u32 grid_width, u32 grid_height) {
@@ -25,10 +26,21 @@ position generate_next_reward_position(position current_reward, position* player
 }
 
 position ensure_reward_position_not_on_player(position reward, position* begin, position* end,
-                                        i32 grid_height, i32 grid_width) {
+                                        i32 grid_height, i32 grid_width, stack_alloc* alloc) {
     position cand = reward;
 
-    if (position_on_player(cand, begin, end)) {
+    u8 on_player = 0;
+    for (position* cell = begin; cell < end && !on_player; ++cell) {
+        on_player = cell->x == cand.x && cell->y == cand.y;
+    }
+
+    if (on_player) {
+        // Index the player cells once so that scanning the grid does not rescan the player for each cell
+        hash_map* player_cells = hash_map_init(alloc, HASH_MAP_KEY_U64, bytesize(begin, end) / sizeof(*begin));
+        for (position* cell = begin; cell < end; ++cell) {
+            hash_map_insert_u64(player_cells, position_key(*cell), 0);
+        }
+
         // Find the nearest cell position from cand_x, cand_y that is not intersecting with the player
         position best = cand;
         const i32 max_dist = grid_height * grid_width;
@@ -37,7 +49,7 @@ position ensure_reward_position_not_on_player(position reward, position* begin,
         for (i32 yy = 0; yy < grid_height; ++yy) {
             for (i32 xx = 0; xx < grid_width; ++xx) {
                 // skip positions that collide with player
-                if (position_on_player((position){xx, yy}, begin, end)) {
+                if (position_on_player((position){xx, yy}, player_cells)) {
                     continue;
                 }
 
@@ -55,6 +67,7 @@ position ensure_reward_position_not_on_player(position reward, position* begin,
             }
         }
 
+        hash_map_deinit(alloc, player_cells);
         if (best_dist != max_dist) {
             return best;
         }
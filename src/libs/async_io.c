@@ -0,0 +1,516 @@
+#define _GNU_SOURCE // accept4
+
+#include "async_io.h"
+#include "assert.h"
+#include "network/tcp/tcp_connection_type.h"
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+typedef enum {
+    OP_READ,
+    OP_WRITE,
+    OP_ACCEPT,
+    OP_CONNECT
+} op_type;
+
+// Operation waiting in the epoll backend
+typedef struct {
+    op_type type;
+    file_t file;
+    u8* buffer;
+    uptr size;
+    i64 offset;
+    uptr user_data;
+    iptr result;
+    i32 file_flags;     // Flags to restore after a non-blocking connect
+    u8 active;
+    u8 socket;          // Waits for epoll readiness, otherwise performed directly
+    u8 done;            // Finished at queue time, result is set
+} pending_op;
+
+typedef struct {
+    file_t fd;
+    u32* sq_head;
+    u32* sq_tail;
+    u32* sq_mask;
+    u32* sq_array;
+    u32 sq_entries;
+    struct io_uring_sqe* sqes;
+    u32* cq_head;
+    u32* cq_tail;
+    u32* cq_mask;
+    struct io_uring_cqe* cqes;
+    void* ring;
+    uptr ring_size;
+    void* sqes_map;
+    uptr sqes_size;
+    u32 to_submit;
+    u8 fixed_buffers;   // The buffer region is registered as fixed buffer 0
+} uring;
+
+struct async_io {
+    void* allocation;
+    async_io_backend backend;
+    stack_alloc buffers;
+    u8* buffers_begin;
+    u8* buffers_end;
+    u32 in_flight;
+    // io_uring backend
+    uring ring;
+    // epoll backend
+    file_t epoll;
+    pending_op* ops;
+    u32 op_capacity;
+    u32 epoll_to_submit;
+};
+
+static u8 in_buffers(async_io* io, const void* begin, const void* end) {
+    return (const u8*)begin >= io->buffers_begin && (const u8*)end <= io->buffers_end;
+}
+
+/* io_uring backend */
+
+static u8 uring_init(async_io* io, u32 queue_size) {
+    uring* r = &io->ring;
+    struct io_uring_params params;
+    __builtin_memset(&params, 0, sizeof(params));
+
+    const long fd = syscall(__NR_io_uring_setup, queue_size, &params);
+    if (fd < 0) {
+        return 0;
+    }
+    r->fd = (file_t)fd;
+
+    // Submission and completion rings share one mapping on every kernel that has IORING_FEAT_SINGLE_MMAP
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP)) {
+        close(r->fd);
+        return 0;
+    }
+    const uptr sq_size = params.sq_off.array + params.sq_entries * sizeof(u32);
+    const uptr cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    r->ring_size = sq_size > cq_size ? sq_size : cq_size;
+    r->ring = mmap(0, r->ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+    if (r->ring == MAP_FAILED) {
+        close(r->fd);
+        return 0;
+    }
+    r->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes_map = mmap(0, r->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+    if (r->sqes_map == MAP_FAILED) {
+        munmap(r->ring, r->ring_size);
+        close(r->fd);
+        return 0;
+    }
+
+    r->sq_head = byteoffset(r->ring, params.sq_off.head);
+    r->sq_tail = byteoffset(r->ring, params.sq_off.tail);
+    r->sq_mask = byteoffset(r->ring, params.sq_off.ring_mask);
+    r->sq_array = byteoffset(r->ring, params.sq_off.array);
+    r->sq_entries = params.sq_entries;
+    r->sqes = r->sqes_map;
+    r->cq_head = byteoffset(r->ring, params.cq_off.head);
+    r->cq_tail = byteoffset(r->ring, params.cq_off.tail);
+    r->cq_mask = byteoffset(r->ring, params.cq_off.ring_mask);
+    r->cqes = byteoffset(r->ring, params.cq_off.cqes);
+    r->to_submit = 0;
+
+    // Registration can fail under a low RLIMIT_MEMLOCK, operations then use regular buffers
+    struct iovec region = {.iov_base = io->buffers_begin, .iov_len = bytesize(io->buffers_begin, io->buffers_end)};
+    r->fixed_buffers = region.iov_len > 0
+        && syscall(__NR_io_uring_register, r->fd, IORING_REGISTER_BUFFERS, &region, 1) == 0;
+    return 1;
+}
+
+static void uring_deinit(uring* r) {
+    munmap(r->sqes_map, r->sqes_size);
+    munmap(r->ring, r->ring_size);
+    close(r->fd);
+}
+
+// 0 when the submission ring is full or queue_size operations are in flight, the completion
+// ring has room for those only
+static struct io_uring_sqe* uring_get_sqe(async_io* io) {
+    uring* r = &io->ring;
+    if (io->in_flight >= io->op_capacity) {
+        return 0;
+    }
+    const u32 tail = *r->sq_tail;
+    const u32 head = __atomic_load_n(r->sq_head, __ATOMIC_ACQUIRE);
+    if (tail - head >= r->sq_entries) {
+        return 0;
+    }
+    const u32 index = tail & *r->sq_mask;
+    struct io_uring_sqe* sqe = &r->sqes[index];
+    __builtin_memset(sqe, 0, sizeof(*sqe));
+    r->sq_array[index] = index;
+    return sqe;
+}
+
+static void uring_push_sqe(uring* r) {
+    __atomic_store_n(r->sq_tail, *r->sq_tail + 1, __ATOMIC_RELEASE);
+    r->to_submit += 1;
+}
+
+static u8 uring_queue_rw(async_io* io, u8 opcode, u8 fixed_opcode, file_t file, const void* begin, const void* end, i64 offset, uptr user_data) {
+    uring* r = &io->ring;
+    struct io_uring_sqe* sqe = uring_get_sqe(io);
+    if (!sqe) {
+        return 0;
+    }
+    const u8 fixed = r->fixed_buffers && in_buffers(io, begin, end);
+    sqe->opcode = fixed ? fixed_opcode : opcode;
+    sqe->fd = file;
+    sqe->off = (u64)offset;
+    sqe->addr = (u64)(uptr)begin;
+    sqe->len = (u32)bytesize(begin, end);
+    sqe->buf_index = 0;
+    sqe->user_data = user_data;
+    uring_push_sqe(r);
+    return 1;
+}
+
+static u32 uring_submit(uring* r) {
+    const u32 count = r->to_submit;
+    if (count == 0) {
+        return 0;
+    }
+    const long submitted = syscall(__NR_io_uring_enter, r->fd, count, 0, 0, 0, 0);
+    if (submitted <= 0) {
+        return 0;
+    }
+    r->to_submit -= (u32)submitted;
+    return (u32)submitted;
+}
+
+static u32 uring_complete(async_io* io, async_io_completion* begin, async_io_completion* end, u8 wait) {
+    uring* r = &io->ring;
+    u32 head = *r->cq_head;
+    u32 tail = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+    if (head == tail && wait && io->in_flight > 0) {
+        // Operations queued without async_io_submit go out with the wait, else nothing would complete
+        long submitted;
+        do {
+            submitted = syscall(__NR_io_uring_enter, r->fd, r->to_submit, 1, IORING_ENTER_GETEVENTS, 0, 0);
+        } while (submitted < 0 && errno == EINTR);
+        if (submitted > 0) {
+            r->to_submit -= (u32)submitted;
+        }
+        tail = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+    }
+
+    u32 count = 0;
+    for (async_io_completion* c = begin; c < end && head != tail; ++c, ++head, ++count) {
+        const struct io_uring_cqe* cqe = &r->cqes[head & *r->cq_mask];
+        c->user_data = (uptr)cqe->user_data;
+        c->result = cqe->res;
+    }
+    __atomic_store_n(r->cq_head, head, __ATOMIC_RELEASE);
+    return count;
+}
+
+/* epoll backend */
+
+static pending_op* epoll_op_alloc(async_io* io) {
+    for (u32 i = 0; i < io->op_capacity; ++i) {
+        if (!io->ops[i].active) {
+            pending_op* op = &io->ops[i];
+            __builtin_memset(op, 0, sizeof(*op));
+            op->active = 1;
+            op->offset = -1;
+            io->epoll_to_submit += 1;
+            return op;
+        }
+    }
+    return 0;
+}
+
+static u32 op_events(const pending_op* op) {
+    return (op->type == OP_READ || op->type == OP_ACCEPT) ? EPOLLIN : EPOLLOUT;
+}
+
+// Register the union of the events awaited on file, or remove it when nothing waits on it anymore
+static void epoll_update(async_io* io, file_t file) {
+    u32 events = 0;
+    for (u32 i = 0; i < io->op_capacity; ++i) {
+        const pending_op* op = &io->ops[i];
+        if (op->active && op->socket && !op->done && op->file == file) {
+            events |= op_events(op);
+        }
+    }
+
+    if (events == 0) {
+        epoll_ctl(io->epoll, EPOLL_CTL_DEL, file, 0);
+        return;
+    }
+    struct epoll_event event = {.events = events, .data.fd = file};
+    if (epoll_ctl(io->epoll, EPOLL_CTL_MOD, file, &event) != 0 && errno == ENOENT) {
+        epoll_ctl(io->epoll, EPOLL_CTL_ADD, file, &event);
+    }
+}
+
+static u8 is_socket(file_t file) {
+    struct stat st;
+    return fstat(file, &st) == 0 && S_ISSOCK(st.st_mode);
+}
+
+static iptr syscall_result(iptr result) {
+    return result < 0 ? -(iptr)errno : result;
+}
+
+// Perform the operation, returns -EAGAIN when a socket is not ready yet
+static iptr epoll_perform(pending_op* op) {
+    switch (op->type) {
+        case OP_READ:
+            if (op->socket) {
+                return syscall_result(recv(op->file, op->buffer, op->size, MSG_DONTWAIT));
+            }
+            return syscall_result(op->offset < 0
+                ? read(op->file, op->buffer, op->size)
+                : pread(op->file, op->buffer, op->size, (off_t)op->offset));
+        case OP_WRITE:
+            if (op->socket) {
+                return syscall_result(send(op->file, op->buffer, op->size, MSG_DONTWAIT | MSG_NOSIGNAL));
+            }
+            return syscall_result(op->offset < 0
+                ? write(op->file, op->buffer, op->size)
+                : pwrite(op->file, op->buffer, op->size, (off_t)op->offset));
+        case OP_ACCEPT:
+            return syscall_result(accept4(op->file, 0, 0, SOCK_NONBLOCK));
+        case OP_CONNECT: {
+            i32 error = 0;
+            socklen_t size = sizeof(error);
+            getsockopt(op->file, SOL_SOCKET, SO_ERROR, &error, &size);
+            fcntl(op->file, F_SETFL, op->file_flags);
+            return -(iptr)error;
+        }
+    }
+    return -EINVAL;
+}
+
+static u8 epoll_queue(async_io* io, op_type type, file_t file, const void* begin, const void* end, i64 offset, uptr user_data) {
+    pending_op* op = epoll_op_alloc(io);
+    if (!op) {
+        return 0;
+    }
+    op->type = type;
+    op->file = file;
+    op->buffer = (u8*)begin;
+    op->size = bytesize(begin, end);
+    op->offset = offset;
+    op->user_data = user_data;
+    op->socket = type == OP_ACCEPT || is_socket(file);
+    if (op->socket) {
+        epoll_update(io, file);
+    }
+    return 1;
+}
+
+static u32 epoll_complete(async_io* io, async_io_completion* begin, async_io_completion* end, u8 wait) {
+    async_io_completion* c = begin;
+
+    // Regular files are always ready, finished connects already have their result
+    u8 sockets_waiting = 0;
+    for (u32 i = 0; i < io->op_capacity && c < end; ++i) {
+        pending_op* op = &io->ops[i];
+        if (!op->active) {continue;}
+        if (op->socket && !op->done) {
+            sockets_waiting = 1;
+            continue;
+        }
+        c->user_data = op->user_data;
+        c->result = op->done ? op->result : epoll_perform(op);
+        op->active = 0;
+        ++c;
+    }
+    if (c != begin || !sockets_waiting) {
+        return (u32)(c - begin);
+    }
+
+    struct epoll_event events[32];
+    i32 ready;
+    do {
+        ready = epoll_wait(io->epoll, events, 32, wait ? -1 : 0);
+    } while (ready < 0 && errno == EINTR);
+
+    for (i32 e = 0; e < ready; ++e) {
+        const file_t file = events[e].data.fd;
+        for (u32 i = 0; i < io->op_capacity && c < end; ++i) {
+            pending_op* op = &io->ops[i];
+            if (!op->active || !op->socket || op->file != file) {continue;}
+            if (!(events[e].events & (op_events(op) | EPOLLERR | EPOLLHUP))) {continue;}
+
+            const iptr result = epoll_perform(op);
+            if (result == -EAGAIN || result == -EWOULDBLOCK) {continue;}
+            c->user_data = op->user_data;
+            c->result = result;
+            op->active = 0;
+            ++c;
+        }
+        epoll_update(io, file);
+    }
+    return (u32)(c - begin);
+}
+
+/* Interface */
+
+async_io* async_io_init(stack_alloc* alloc, u32 queue_size, uptr buffer_size, async_io_backend backend) {
+    debug_assert(queue_size > 0);
+    void* begin = alloc->cursor;
+
+    u8* buffers = sa_alloc(alloc, buffer_size);
+    pending_op* ops = sa_alloc(alloc, sizeof(*ops) * queue_size);
+    async_io* io = sa_alloc(alloc, sizeof(*io));
+    __builtin_memset(io, 0, sizeof(*io));
+    io->allocation = begin;
+    io->buffers_begin = buffers;
+    io->buffers_end = buffers + buffer_size;
+    sa_init(&io->buffers, buffers, buffers + buffer_size);
+    io->ops = ops;
+    io->op_capacity = queue_size;
+    io->epoll = file_invalid();
+
+    if (backend == ASYNC_IO_BACKEND_DEFAULT && uring_init(io, queue_size)) {
+        io->backend = ASYNC_IO_BACKEND_DEFAULT;
+        return io;
+    }
+
+    io->epoll = (file_t)epoll_create1(EPOLL_CLOEXEC);
+    if (io->epoll == file_invalid()) {
+        sa_free(alloc, begin);
+        return 0;
+    }
+    io->backend = ASYNC_IO_BACKEND_EPOLL;
+    __builtin_memset(ops, 0, sizeof(*ops) * queue_size);
+    return io;
+}
+
+void async_io_deinit(stack_alloc* alloc, async_io* io) {
+    debug_assert(byteoffset(io, sizeof(*io)) == alloc->cursor);
+    if (io->backend == ASYNC_IO_BACKEND_DEFAULT) {
+        uring_deinit(&io->ring);
+    } else {
+        close(io->epoll);
+    }
+    sa_free(alloc, io->allocation);
+}
+
+async_io_backend async_io_get_backend(async_io* io) {
+    return io->backend;
+}
+
+stack_alloc* async_io_buffers(async_io* io) {
+    return &io->buffers;
+}
+
+u8 async_io_read(async_io* io, file_t file, u8_slice buffer, i64 offset, uptr user_data) {
+    u8 queued;
+    if (io->backend == ASYNC_IO_BACKEND_DEFAULT) {
+        queued = uring_queue_rw(io, IORING_OP_READ, IORING_OP_READ_FIXED, file, buffer.begin, buffer.end, offset, user_data);
+    } else {
+        queued = epoll_queue(io, OP_READ, file, buffer.begin, buffer.end, offset, user_data);
+    }
+    io->in_flight += queued;
+    return queued;
+}
+
+u8 async_io_write(async_io* io, file_t file, const void* begin, const void* end, i64 offset, uptr user_data) {
+    u8 queued;
+    if (io->backend == ASYNC_IO_BACKEND_DEFAULT) {
+        queued = uring_queue_rw(io, IORING_OP_WRITE, IORING_OP_WRITE_FIXED, file, begin, end, offset, user_data);
+    } else {
+        queued = epoll_queue(io, OP_WRITE, file, begin, end, offset, user_data);
+    }
+    io->in_flight += queued;
+    return queued;
+}
+
+u8 async_io_accept(async_io* io, tcp* server, uptr user_data) {
+    debug_assert(server->fd != file_invalid());
+    u8 queued;
+    if (io->backend == ASYNC_IO_BACKEND_DEFAULT) {
+        struct io_uring_sqe* sqe = uring_get_sqe(io);
+        queued = sqe != 0;
+        if (sqe) {
+            sqe->opcode = IORING_OP_ACCEPT;
+            sqe->fd = server->fd;
+            sqe->accept_flags = SOCK_NONBLOCK;
+            sqe->user_data = user_data;
+            uring_push_sqe(&io->ring);
+        }
+    } else {
+        queued = epoll_queue(io, OP_ACCEPT, server->fd, 0, 0, -1, user_data);
+    }
+    io->in_flight += queued;
+    return queued;
+}
+
+u8 async_io_connect(async_io* io, tcp* client, uptr user_data) {
+    debug_assert(client->fd != file_invalid());
+    debug_assert(client->chosen != 0);
+    u8 queued;
+    if (io->backend == ASYNC_IO_BACKEND_DEFAULT) {
+        struct io_uring_sqe* sqe = uring_get_sqe(io);
+        queued = sqe != 0;
+        if (sqe) {
+            sqe->opcode = IORING_OP_CONNECT;
+            sqe->fd = client->fd;
+            sqe->addr = (u64)(uptr)client->chosen->ai_addr;
+            sqe->off = client->chosen->ai_addrlen;
+            sqe->user_data = user_data;
+            uring_push_sqe(&io->ring);
+        }
+    } else {
+        pending_op* op = epoll_op_alloc(io);
+        queued = op != 0;
+        if (op) {
+            // Start a non-blocking connect, completion is signaled by writability
+            op->type = OP_CONNECT;
+            op->file = client->fd;
+            op->user_data = user_data;
+            op->socket = 1;
+            op->file_flags = fcntl(client->fd, F_GETFL, 0);
+            fcntl(client->fd, F_SETFL, op->file_flags | O_NONBLOCK);
+            const iptr result = syscall_result(connect(client->fd, client->chosen->ai_addr, client->chosen->ai_addrlen));
+            if (result != -EINPROGRESS) {
+                op->result = result;
+                op->done = 1;
+                fcntl(client->fd, F_SETFL, op->file_flags);
+            } else {
+                epoll_update(io, client->fd);
+            }
+        }
+    }
+    io->in_flight += queued;
+    return queued;
+}
+
+u32 async_io_submit(async_io* io) {
+    if (io->backend == ASYNC_IO_BACKEND_DEFAULT) {
+        return uring_submit(&io->ring);
+    }
+    // Operations are handed to epoll as they are queued
+    const u32 count = io->epoll_to_submit;
+    io->epoll_to_submit = 0;
+    return count;
+}
+
+u32 async_io_complete(async_io* io, async_io_completion* begin, async_io_completion* end, u8 wait) {
+    u32 count;
+    if (io->backend == ASYNC_IO_BACKEND_DEFAULT) {
+        count = uring_complete(io, begin, end, wait);
+    } else {
+        count = epoll_complete(io, begin, end, wait);
+    }
+    io->in_flight -= count;
+    return count;
+}
@@ -0,0 +1,65 @@
+#ifndef ASYNC_IO_H
+#define ASYNC_IO_H
+
+#include "primitive.h"
+#include "stack_alloc.h"
+#include "file.h"
+#include "network/tcp/tcp_connection.h"
+
+// Asynchronous file and socket I/O
+//
+// Operations are queued with an opaque user_data value, sent to the kernel in one batch by
+// async_io_submit and reported back through async_io_complete. The io_uring backend is used
+// when the kernel allows it. Otherwise the epoll backend is used: regular files complete at the
+// next async_io_complete call, sockets complete once epoll reports them ready.
+//
+// A buffer region is allocated at init and registered with the kernel when possible. Reads and
+// writes whose buffer lies inside that region skip the per-operation page pinning. Buffers are
+// allocated from the stack_alloc returned by async_io_buffers.
+//
+// Example usage:
+//   async_io* io = async_io_init(alloc, 64, 1024 * 1024, ASYNC_IO_BACKEND_DEFAULT);
+//   u8* buffer = sa_alloc(async_io_buffers(io), 4096);
+//   async_io_read(io, file, (u8_slice){buffer, buffer + 4096}, 0, 1);
+//   async_io_submit(io);
+//   async_io_completion completions[16];
+//   u32 count = async_io_complete(io, completions, completions + 16, 1);
+//   async_io_deinit(alloc, io);
+
+typedef enum {
+    ASYNC_IO_BACKEND_DEFAULT,   // io_uring when available, epoll otherwise
+    ASYNC_IO_BACKEND_EPOLL
+} async_io_backend;
+
+typedef struct {
+    uptr user_data;
+    // Bytes transferred for reads and writes, descriptor for accepts, 0 for connects.
+    // Negative errno on failure.
+    iptr result;
+} async_io_completion;
+
+typedef struct async_io async_io;
+
+// 'queue_size' bounds the number of operations in flight. Returns 0 if no backend can be created.
+async_io* async_io_init(stack_alloc* alloc, u32 queue_size, uptr buffer_size, async_io_backend backend);
+// Queued and in-flight operations are dropped. io must be the last allocation of alloc.
+void async_io_deinit(stack_alloc* alloc, async_io* io);
+
+async_io_backend async_io_get_backend(async_io* io);
+stack_alloc* async_io_buffers(async_io* io);
+
+// Queue an operation. 'offset' is the file offset, -1 uses and advances the file position (and
+// must be used for sockets). Returns 0 when the queue is full.
+u8 async_io_read(async_io* io, file_t file, u8_slice buffer, i64 offset, uptr user_data);
+u8 async_io_write(async_io* io, file_t file, const void* begin, const void* end, i64 offset, uptr user_data);
+u8 async_io_accept(async_io* io, tcp* server, uptr user_data);
+u8 async_io_connect(async_io* io, tcp* client, uptr user_data);
+
+// Send the queued operations to the kernel with a single syscall. Returns the number submitted.
+u32 async_io_submit(async_io* io);
+
+// Store finished operations in [begin, end) and return their count. With 'wait', blocks until at
+// least one operation finishes, unless none is in flight.
+u32 async_io_complete(async_io* io, async_io_completion* begin, async_io_completion* end, u8 wait);
+
+#endif /* ASYNC_IO_H */
@@ -4,10 +4,16 @@
 #include "file.h"
 #include "stack_alloc.h"
 #include "exec_command.h"
+#include "mem.h"
 
 #include <execinfo.h>
 #include <unistd.h>
 
+static u8 line_is_address(string line) {
+    const u8* text = line.begin;
+    return text[0] == '0' && text[1] == 'x';
+}
+
 void print_backtrace(file_t file) {
     void *buffer[64];
     i32 nptrs = backtrace(buffer, 64);
@@ -22,42 +28,47 @@ void print_backtrace(file_t file) {
 
     print_string(file, STRING("Backtrace (most recent call last):\n") );
 
+    // A single addr2line resolves every frame, -a prints the address before the lines of a frame
+    const uptr memory_size = 64 * 1024;
+    void* memory = mem_map(memory_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, memory_size));
+
+    string* argv = sa_alloc(&alloc, sizeof(*argv) * (7 + (uptr)nptrs));
+    argv[0] = STRING("addr2line");
+    argv[1] = STRING("-e");
+    argv[2] = exe_path_str;
+    argv[3] = STRING("-f");
+    argv[4] = STRING("-C");
+    argv[5] = STRING("-i");
+    argv[6] = STRING("-a");
     for (i32 i = 0; i < nptrs; i++) {
-        u8 cmd[2048];
-        stack_alloc alloc;
-        sa_init(&alloc, cmd, byteoffset(cmd, sizeof(cmd)));
-        print_format_to_buffer(&alloc, STRING("addr2line -e %s -f -C -i %p\0"), exe_path_str, buffer[i]);
-        
-        u8* cmd_end = cmd;
-        while (*cmd_end) { ++cmd_end; }
-        string cmd_str = { cmd, cmd_end };
-
-        exec_command_result cmd_res = exec_command(cmd_str, &alloc);
-        string result;
-        result.begin = cmd_res.output;
-        result.end = alloc.cursor;
-
-        {
-            const u8* cursor = result.begin;
-            const u8* line_begin = cursor;
-            while (1) {
-                if (cursor == result.end || *cursor == '\n') {
-                    const u8* line_end = cursor;
-                    if (bytesize(line_begin, line_end) > 0) {
-                        print_format(file, STRING("  [%d] %s\n"), i, (string){line_begin, line_end});
-                    }
-                    line_begin = byteoffset(cursor, 1);
-                }
-                
-                if (cursor == result.end) {
-                    break;
-                }
-
-                cursor = byteoffset(cursor, 1);
-            }
+        argv[7 + i].begin = print_format_to_buffer(&alloc, STRING("%p"), buffer[i]);
+        argv[7 + i].end = alloc.cursor;
+    }
+    exec_command_result cmd_res = exec_command_argv(argv, argv + 7 + nptrs, &alloc);
+    string result = {cmd_res.output, alloc.cursor};
+
+    u8 writer_buffer[1024];
+    file_writer writer;
+    file_writer_init(&writer, file, writer_buffer, byteoffset(writer_buffer, sizeof(writer_buffer)));
+    i32 frame = -1;
+    const u8* line_begin = result.begin;
+    for (const u8* cursor = result.begin; cursor < (const u8*)result.end; ++cursor) {
+        if (*cursor != '\n') {
+            continue;
+        }
+        const string line = {line_begin, cursor};
+        line_begin = cursor + 1;
+        if (bytesize(line.begin, line.end) > 2 && line_is_address(line)) {
+            frame += 1;
+        } else if (bytesize(line.begin, line.end) > 0) {
+            PRINT_FORMAT_TO_WRITER(&writer, STRING("  [%d] %s\n"), frame, line);
         }
-        
-        sa_free(&alloc, cmd);
-        sa_deinit(&alloc);
     }
+    file_writer_flush(&writer);
+
+    sa_free(&alloc, argv);
+    sa_deinit(&alloc);
+    mem_unmap(memory, memory_size);
 }
@@ -1,436 +1,395 @@
 #include "convert.h"
+#include "convert_f64_table.h"
+
+// "00" to "99", indexed by twice the value
+static const char decimal_pairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const u64 powers_of_10[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+    1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+    100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+    1000000000000000000ull, 10000000000000000000ull
+};
+
+u32 convert_u64_decimal_digits(u64 value) {
+    // log10(2) ~= 1233 / 4096, may be one too high, corrected with the table. 0 counts as 1.
+    const u64 nonzero = value | 1;
+    const u32 bits = 64 - (u32)__builtin_clzll(nonzero);
+    const u32 estimate = (bits * 1233) >> 12;
+    return estimate + 1 - (nonzero < powers_of_10[estimate]);
+}
 
-// Helper function to convert i8 to string
-char* convert_i8_to_string(i8 value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[32];
-
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
+char* convert_u64_to_decimal(u64 value, char* out) {
+    char* end = out + convert_u64_decimal_digits(value);
+    char* cursor = end;
+    while (value >= 100) {
+        const u32 pair = (u32)(value % 100) * 2;
+        value /= 100;
+        *--cursor = decimal_pairs[pair + 1];
+        *--cursor = decimal_pairs[pair];
+    }
+    if (value >= 10) {
+        *--cursor = decimal_pairs[value * 2 + 1];
+        *--cursor = decimal_pairs[value * 2];
     } else {
-        // Handle negative numbers
-        int is_negative = 0;
-        i8 temp = value;
-        if (temp < 0) {
-            is_negative = 1;
-            temp = -temp;
-        }
-
-        // Convert digits
-        char temp_buf[32];
-        int temp_idx = 0;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
-
-        // Add negative sign if needed
-        if (is_negative) {
-            temp_buffer[idx++] = '-';
-        }
-
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
-        }
+        *--cursor = (char)('0' + value);
     }
+    return end;
+}
 
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
+char* convert_i64_to_decimal(i64 value, char* out) {
+    if (value < 0) {
+        *out++ = '-';
+        // Negate as unsigned so that the minimum value does not overflow
+        return convert_u64_to_decimal(-(u64)value, out);
     }
-
-    return result;
+    return convert_u64_to_decimal((u64)value, out);
 }
 
-// Helper function to convert u8 to string
-char* convert_u8_to_string(u8 value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[32];
-
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
-    } else {
-        // Convert digits
-        char temp_buf[32];
-        int temp_idx = 0;
-        u8 temp = value;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
-
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
-        }
-    }
+u32 convert_u64_hex_digits(u64 value) {
+    return (64 - (u32)__builtin_clzll(value | 1) + 3) / 4;
+}
 
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
+char* convert_u64_to_hex(u64 value, u32 min_digits, char* out) {
+    static const char hex_digits[16] = "0123456789abcdef";
+    const u32 digits = convert_u64_hex_digits(value);
+    const u32 count = digits > min_digits ? digits : min_digits;
+    char* end = out + count;
+    for (char* cursor = end; cursor != out; value >>= 4) {
+        *--cursor = hex_digits[value & 0xf];
     }
+    return end;
+}
 
+static char* unsigned_to_string(u64 value, stack_alloc* alloc) {
+    char* result = sa_alloc(alloc, convert_u64_decimal_digits(value));
+    convert_u64_to_decimal(value, result);
     return result;
 }
 
-// Helper function to convert i16 to string
-char* convert_i16_to_string(i16 value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[32];
-
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
-    } else {
-        // Handle negative numbers
-        int is_negative = 0;
-        i16 temp = value;
-        if (temp < 0) {
-            is_negative = 1;
-            temp = -temp;
-        }
-
-        // Convert digits
-        char temp_buf[32];
-        int temp_idx = 0;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
-
-        // Add negative sign if needed
-        if (is_negative) {
-            temp_buffer[idx++] = '-';
-        }
-
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
-        }
-    }
-
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
-    }
-
+static char* signed_to_string(i64 value, stack_alloc* alloc) {
+    const u64 magnitude = value < 0 ? -(u64)value : (u64)value;
+    char* result = sa_alloc(alloc, convert_u64_decimal_digits(magnitude) + (value < 0));
+    convert_i64_to_decimal(value, result);
     return result;
 }
 
-// Helper function to convert u16 to string
-char* convert_u16_to_string(u16 value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[32];
-
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
-    } else {
-        // Convert digits
-        char temp_buf[32];
-        int temp_idx = 0;
-        u16 temp = value;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
+char* convert_i8_to_string(i8 value, stack_alloc* alloc) {
+    return signed_to_string(value, alloc);
+}
 
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
-        }
-    }
+char* convert_u8_to_string(u8 value, stack_alloc* alloc) {
+    return unsigned_to_string(value, alloc);
+}
 
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
-    }
+char* convert_i16_to_string(i16 value, stack_alloc* alloc) {
+    return signed_to_string(value, alloc);
+}
 
-    return result;
+char* convert_u16_to_string(u16 value, stack_alloc* alloc) {
+    return unsigned_to_string(value, alloc);
 }
 
-// Helper function to convert i32 to string
 char* convert_i32_to_string(i32 value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[32];
+    return signed_to_string(value, alloc);
+}
 
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
-    } else {
-        // Handle negative numbers
-        int is_negative = 0;
-        i32 temp = value;
-        if (temp < 0) {
-            is_negative = 1;
-            temp = -temp;
-        }
+char* convert_u32_to_string(u32 value, stack_alloc* alloc) {
+    return unsigned_to_string(value, alloc);
+}
 
-        // Convert digits
-        char temp_buf[32];
-        int temp_idx = 0;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
+char* convert_i64_to_string(i64 value, stack_alloc* alloc) {
+    return signed_to_string(value, alloc);
+}
 
-        // Add negative sign if needed
-        if (is_negative) {
-            temp_buffer[idx++] = '-';
-        }
+char* convert_u64_to_string(u64 value, stack_alloc* alloc) {
+    return unsigned_to_string(value, alloc);
+}
 
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
-        }
-    }
+char* convert_iptr_to_string(iptr value, stack_alloc* alloc) {
+    return signed_to_string(value, alloc);
+}
 
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
-    }
+char* convert_uptr_to_string(uptr value, stack_alloc* alloc) {
+    return unsigned_to_string(value, alloc);
+}
 
+char* convert_u64_to_hex_string(u64 value, u32 min_digits, stack_alloc* alloc) {
+    const u32 digits = convert_u64_hex_digits(value);
+    char* result = sa_alloc(alloc, digits > min_digits ? digits : min_digits);
+    convert_u64_to_hex(value, min_digits, result);
     return result;
 }
 
-// Helper function to convert u32 to string
-char* convert_u32_to_string(u32 value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[32];
-
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
-    } else {
-        // Convert digits
-        char temp_buf[32];
-        int temp_idx = 0;
-        u32 temp = value;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
-
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
-        }
-    }
-
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
-    }
-
+// "0x" followed by at least 8 hexadecimal digits, "0x0" for NULL
+char* convert_pointer_to_string(void* ptr, stack_alloc* alloc) {
+    const uptr value = (uptr)ptr;
+    char* result = sa_alloc(alloc, 2);
+    result[0] = '0';
+    result[1] = 'x';
+    convert_u64_to_hex_string(value, value ? 8 : 1, alloc);
     return result;
 }
 
-// Helper function to convert i64 to string
-char* convert_i64_to_string(i64 value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[64];
-
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
-    } else {
-        // Handle negative numbers
-        int is_negative = 0;
-        i64 temp = value;
-        if (temp < 0) {
-            is_negative = 1;
-            temp = -temp;
-        }
-
-        // Convert digits
-        char temp_buf[64];
-        int temp_idx = 0;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
+// Shortest f64 conversion (Ryu, Ulf Adams 2018)
+//
+// The binary value and the halfway points to its neighbours are scaled by a power of ten with
+// 128-bit multiplications, then decimal digits are dropped while the result stays strictly
+// between the halfway points. The result is the shortest decimal that parses back to the same
+// value, ties in the last digit are rounded to even.
 
-        // Add negative sign if needed
-        if (is_negative) {
-            temp_buffer[idx++] = '-';
-        }
+#define F64_MANTISSA_BITS 52
+#define F64_EXPONENT_BITS 11
+#define F64_BIAS 1023
 
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
-        }
-    }
+__extension__ typedef unsigned __int128 u128;
 
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
-    }
+typedef struct {
+    u64 mantissa;
+    i32 exponent;               // value = mantissa * 10^exponent
+} decimal_f64;
 
-    return result;
+// ceil(log2(5^e)), e in [0, 3528]
+static i32 pow5_bits(i32 e) {
+    return (i32)(((u32)e * 1217359) >> 19) + 1;
 }
 
-// Helper function to convert u64 to string
-char* convert_u64_to_string(u64 value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[64];
-
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
-    } else {
-        // Convert digits
-        char temp_buf[64];
-        int temp_idx = 0;
-        u64 temp = value;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
+// floor(log10(2^e)), e in [0, 1650]
+static u32 log10_pow2(i32 e) {
+    return ((u32)e * 78913) >> 18;
+}
 
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
-        }
-    }
+// floor(log10(5^e)), e in [0, 2620]
+static u32 log10_pow5(i32 e) {
+    return ((u32)e * 732923) >> 20;
+}
 
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
+static u8 multiple_of_power_of_5(u64 value, u32 p) {
+    u32 count = 0;
+    while (value % 5 == 0) {
+        value /= 5;
+        count += 1;
     }
+    return count >= p;
+}
 
-    return result;
+static u8 multiple_of_power_of_2(u64 value, u32 p) {
+    return (value & ((1ull << p) - 1)) == 0;
 }
 
-// Helper function to convert iptr to string
-char* convert_iptr_to_string(iptr value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[64];
+static u64 mul_shift_64(u64 m, const u64* mul, i32 j) {
+    const u128 low = (u128)m * mul[0];
+    const u128 high = (u128)m * mul[1];
+    return (u64)(((low >> 64) + high) >> (j - 64));
+}
 
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
+static decimal_f64 f64_to_decimal(u64 ieee_mantissa, u32 ieee_exponent) {
+    i32 e2;
+    u64 m2;
+    if (ieee_exponent == 0) {
+        // Subnormal
+        e2 = 1 - F64_BIAS - F64_MANTISSA_BITS - 2;
+        m2 = ieee_mantissa;
     } else {
-        // Handle negative numbers
-        int is_negative = 0;
-        iptr temp = value;
-        if (temp < 0) {
-            is_negative = 1;
-            temp = -temp;
-        }
-
-        // Convert digits
-        char temp_buf[64];
-        int temp_idx = 0;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
-
-        // Add negative sign if needed
-        if (is_negative) {
-            temp_buffer[idx++] = '-';
+        e2 = (i32)ieee_exponent - F64_BIAS - F64_MANTISSA_BITS - 2;
+        m2 = (1ull << F64_MANTISSA_BITS) | ieee_mantissa;
+    }
+    const u8 accept_bounds = (m2 & 1) == 0;
+
+    // Value and halfway points, times 4. The lower gap is halved at powers of two.
+    const u64 mv = 4 * m2;
+    const u32 mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+
+    u64 vr, vp, vm;
+    i32 e10;
+    u8 vm_trailing_zeros = 0;
+    u8 vr_trailing_zeros = 0;
+    if (e2 >= 0) {
+        const u32 q = log10_pow2(e2) - (e2 > 3);
+        e10 = (i32)q;
+        const i32 k = CONVERT_F64_POW5_INV_BITCOUNT + pow5_bits((i32)q) - 1;
+        const i32 i = -e2 + (i32)q + k;
+        vr = mul_shift_64(4 * m2, convert_f64_pow5_inv[q], i);
+        vp = mul_shift_64(4 * m2 + 2, convert_f64_pow5_inv[q], i);
+        vm = mul_shift_64(4 * m2 - 1 - mm_shift, convert_f64_pow5_inv[q], i);
+        if (q <= 21) {
+            // Only one of mp, mv and mm can be a multiple of 5
+            if (mv % 5 == 0) {
+                vr_trailing_zeros = multiple_of_power_of_5(mv, q);
+            } else if (accept_bounds) {
+                vm_trailing_zeros = multiple_of_power_of_5(mv - 1 - mm_shift, q);
+            } else {
+                vp -= multiple_of_power_of_5(mv + 2, q);
+            }
         }
-
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
+    } else {
+        const u32 q = log10_pow5(-e2) - (-e2 > 1);
+        e10 = (i32)q + e2;
+        const i32 i = -e2 - (i32)q;
+        const i32 k = pow5_bits(i) - CONVERT_F64_POW5_BITCOUNT;
+        const i32 j = (i32)q - k;
+        vr = mul_shift_64(4 * m2, convert_f64_pow5[i], j);
+        vp = mul_shift_64(4 * m2 + 2, convert_f64_pow5[i], j);
+        vm = mul_shift_64(4 * m2 - 1 - mm_shift, convert_f64_pow5[i], j);
+        if (q <= 1) {
+            // mv has at least q trailing zero bits, as it is a multiple of 4
+            vr_trailing_zeros = 1;
+            if (accept_bounds) {
+                vm_trailing_zeros = mm_shift == 1;
+            } else {
+                --vp;
+            }
+        } else if (q < 63) {
+            vr_trailing_zeros = multiple_of_power_of_2(mv, q);
         }
     }
 
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
+    // Drop digits while the candidates stay inside the interval
+    i32 removed = 0;
+    u8 last_removed_digit = 0;
+    u64 output;
+    if (vm_trailing_zeros || vr_trailing_zeros) {
+        // Exact halfway cases, rare
+        while (vp / 10 > vm / 10) {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = (u8)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed += 1;
+        }
+        if (vm_trailing_zeros) {
+            while (vm % 10 == 0) {
+                vr_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = (u8)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed += 1;
+            }
+        }
+        if (vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+            // Exactly .5, round to even
+            last_removed_digit = 4;
+        }
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+    } else {
+        u8 round_up = 0;
+        if (vp / 100 > vm / 100) {
+            // Two digits at a time
+            round_up = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10) {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed += 1;
+        }
+        output = vr + (vr == vm || round_up);
     }
-
-    return result;
+    return (decimal_f64){output, e10 + removed};
 }
 
-// Helper function to convert uptr to string
-char* convert_uptr_to_string(uptr value, stack_alloc* alloc) {
-    int idx = 0;
-    char temp_buffer[64];
-
-    // Handle special case of 0
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
-    } else {
-        // Convert digits
-        char temp_buf[64];
-        int temp_idx = 0;
-        uptr temp = value;
-        while (temp > 0) {
-            temp_buf[temp_idx++] = '0' + (temp % 10);
-            temp /= 10;
-        }
-
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
-        }
+// Write 'count' zeros
+static char* write_zeros(char* out, i32 count) {
+    for (i32 i = 0; i < count; ++i) {
+        *out++ = '0';
     }
+    return out;
+}
 
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
+// Fixed notation of digits * 10^exponent
+static char* write_fixed(const char* digits, i32 digit_count, i32 exponent, char* out) {
+    const i32 point = digit_count + exponent;
+    if (point <= 0) {
+        *out++ = '0';
+        *out++ = '.';
+        out = write_zeros(out, -point);
+        __builtin_memcpy(out, digits, (uptr)digit_count);
+        return out + digit_count;
     }
-
-    return result;
+    if (exponent >= 0) {
+        __builtin_memcpy(out, digits, (uptr)digit_count);
+        return write_zeros(out + digit_count, exponent);
+    }
+    __builtin_memcpy(out, digits, (uptr)point);
+    out += point;
+    *out++ = '.';
+    __builtin_memcpy(out, digits + point, (uptr)(digit_count - point));
+    return out + digit_count - point;
 }
 
-// Helper function to convert pointer to string
-char* convert_pointer_to_string(void* ptr, stack_alloc* alloc) {
-    // Convert pointer to hexadecimal string
-    uptr value = (uptr)ptr;
-    int idx = 0;
-    char temp_buffer[32];
+// Scientific notation of digits * 10^exponent: d[.ddd]e[-]x
+static char* write_scientific(const char* digits, i32 digit_count, i32 exponent, char* out) {
+    *out++ = digits[0];
+    if (digit_count > 1) {
+        *out++ = '.';
+        __builtin_memcpy(out, digits + 1, (uptr)(digit_count - 1));
+        out += digit_count - 1;
+    }
+    *out++ = 'e';
+    return convert_i64_to_decimal(exponent + digit_count - 1, out);
+}
 
-    temp_buffer[idx++] = '0';
-    temp_buffer[idx++] = 'x';
+char* convert_f64_to_chars(f64 value, convert_float_format format, char* out) {
+    u64 bits;
+    __builtin_memcpy(&bits, &value, sizeof(bits));
+    const u64 ieee_mantissa = bits & ((1ull << F64_MANTISSA_BITS) - 1);
+    const u32 ieee_exponent = (u32)(bits >> F64_MANTISSA_BITS) & ((1u << F64_EXPONENT_BITS) - 1);
+    const u8 sign = (u8)(bits >> 63);
 
-    // Handle special case of NULL pointer
-    if (value == 0) {
-        temp_buffer[idx++] = '0';
-    } else {
-        // Convert to hexadecimal (at least 8 digits for consistency)
-        char temp_buf[32];
-        int temp_idx = 0;
-
-        // Convert digits
-        while (value > 0) {
-            int digit = value % 16;
-            temp_buf[temp_idx++] = (digit < 10) ? ('0' + digit) : ('a' + digit - 10);
-            value /= 16;
+    if (ieee_exponent == (1u << F64_EXPONENT_BITS) - 1) {
+        if (ieee_mantissa) {
+            __builtin_memcpy(out, "nan", 3);
+            return out + 3;
         }
-
-        // Ensure at least 8 digits (pad with zeros if needed)
-        while (temp_idx < 8) {
-            temp_buf[temp_idx++] = '0';
-        }
-
-        // Reverse the digits
-        for (int i = temp_idx - 1; i >= 0; i--) {
-            temp_buffer[idx++] = temp_buf[i];
+        if (sign) {
+            *out++ = '-';
         }
+        __builtin_memcpy(out, "inf", 3);
+        return out + 3;
+    }
+    if (sign) {
+        *out++ = '-';
+    }
+    if (ieee_exponent == 0 && ieee_mantissa == 0) {
+        *out++ = '0';
+        return out;
     }
 
-    // Allocate memory and copy
-    char* result = (char*)sa_alloc(alloc, idx);
-    for (int i = 0; i < idx; i++) {
-        result[i] = temp_buffer[i];
+    const decimal_f64 decimal = f64_to_decimal(ieee_mantissa, ieee_exponent);
+    char digits[CONVERT_U64_MAX_CHARS];
+    const i32 digit_count = (i32)(convert_u64_to_decimal(decimal.mantissa, digits) - digits);
+
+    if (format == CONVERT_FLOAT_GENERAL) {
+        // Fixed notation for values in [1e-4, 1e17), like %g
+        const i32 point = digit_count + decimal.exponent;
+        format = point > -4 && point <= 17 ? CONVERT_FLOAT_FIXED : CONVERT_FLOAT_SCIENTIFIC;
+    }
+    if (format == CONVERT_FLOAT_FIXED) {
+        return write_fixed(digits, digit_count, decimal.exponent, out);
     }
+    return write_scientific(digits, digit_count, decimal.exponent, out);
+}
 
-    return result;
+char* convert_f64_to_string(f64 value, convert_float_format format, stack_alloc* alloc) {
+    char buffer[CONVERT_F64_MAX_CHARS];
+    const uptr size = bytesize(buffer, convert_f64_to_chars(value, format, buffer));
+    return sa_alloc_copy(alloc, buffer, byteoffset(buffer, size));
 }
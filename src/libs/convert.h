@@ -5,6 +5,7 @@
 #include "stack_alloc.h"
 
 // Function declarations for converting primitive types to strings
+// The text is allocated from alloc, exactly as many bytes as there are characters.
 char* convert_i8_to_string(i8 value, stack_alloc* alloc);
 char* convert_u8_to_string(u8 value, stack_alloc* alloc);
 char* convert_i16_to_string(i16 value, stack_alloc* alloc);
@@ -16,5 +17,38 @@ char* convert_u64_to_string(u64 value, stack_alloc* alloc);
 char* convert_iptr_to_string(iptr value, stack_alloc* alloc);
 char* convert_uptr_to_string(uptr value, stack_alloc* alloc);
 char* convert_pointer_to_string(void* ptr, stack_alloc* alloc);
+// Lowercase hexadecimal without prefix, padded with zeros to at least min_digits digits
+char* convert_u64_to_hex_string(u64 value, u32 min_digits, stack_alloc* alloc);
+
+// Conversion cores writing into a caller buffer
+//
+// The digit count is computed first, then the digits are written from the last one, two at a
+// time from a lookup table. Each function returns the end of the written text. A buffer of
+// CONVERT_U64_MAX_CHARS bytes fits any value (sign included).
+#define CONVERT_U64_MAX_CHARS 20
+
+u32 convert_u64_decimal_digits(u64 value);
+char* convert_u64_to_decimal(u64 value, char* out);
+char* convert_i64_to_decimal(i64 value, char* out);
+u32 convert_u64_hex_digits(u64 value);
+char* convert_u64_to_hex(u64 value, u32 min_digits, char* out);
+
+// Shortest round-trip f64 conversion
+//
+// The digits are the fewest that parse back to the exact same value, computed without libc.
+// CONVERT_FLOAT_FIXED never uses an exponent ("0.001", "1500000"), CONVERT_FLOAT_SCIENTIFIC
+// always does ("1e-3", "1.5e6") and CONVERT_FLOAT_GENERAL picks fixed notation for magnitudes in
+// [1e-4, 1e17). Special values are written "nan", "inf" and "-inf".
+typedef enum {
+    CONVERT_FLOAT_FIXED,
+    CONVERT_FLOAT_SCIENTIFIC,
+    CONVERT_FLOAT_GENERAL
+} convert_float_format;
+
+// Longest output, reached in fixed notation by the smallest subnormals
+#define CONVERT_F64_MAX_CHARS 330
+
+char* convert_f64_to_chars(f64 value, convert_float_format format, char* out);
+char* convert_f64_to_string(f64 value, convert_float_format format, stack_alloc* alloc);
 
 #endif /* CONVERT_H */
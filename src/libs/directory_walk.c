@@ -0,0 +1,235 @@
+#include "directory_walk.h"
+#include "assert.h"
+#include "mem.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <pthread.h>
+
+// Memory of a walker thread, only the levels in use are committed
+#define WORKER_MEMORY_SIZE (1024 * 1024)
+
+// One open directory of the walk stack, the NUL terminated name follows the struct
+typedef struct walk_level walk_level;
+struct walk_level {
+    walk_level* previous;
+    DIR* dir;
+    string name;
+    u32 depth;
+};
+
+static walk_level* push_level(stack_alloc* alloc, walk_level* previous, file_t parent, string name, u32 depth) {
+    const uptr name_size = bytesize(name.begin, name.end);
+    walk_level* level = sa_alloc(alloc, sizeof(*level));
+    u8* name_copy = sa_alloc(alloc, name_size + 1);
+    sa_copy(alloc, name.begin, name_copy, name_size);
+    name_copy[name_size] = '\0';
+    // Keep the next level aligned
+    sa_alloc(alloc, (uptr)(-(uptr)alloc->cursor & (sizeof(void*) - 1)));
+
+    level->previous = previous;
+    level->name = (string){name_copy, name_copy + name_size};
+    level->depth = depth;
+    level->dir = 0;
+
+    const i32 fd = openat(parent, (const char*)name_copy, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+    if (fd >= 0) {
+        level->dir = fdopendir(fd);
+        if (!level->dir) {
+            close(fd);
+        }
+    }
+    return level;
+}
+
+static directory_entry_type entry_type(file_t parent, const struct dirent* d) {
+    switch (d->d_type) {
+        case DT_REG: return DIRECTORY_ENTRY_FILE;
+        case DT_DIR: return DIRECTORY_ENTRY_DIRECTORY;
+        case DT_UNKNOWN: break;
+        default: return DIRECTORY_ENTRY_OTHER;
+    }
+    // The file system does not fill d_type
+    struct stat st;
+    if (fstatat(parent, d->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+        return DIRECTORY_ENTRY_OTHER;
+    }
+    if (S_ISREG(st.st_mode)) {return DIRECTORY_ENTRY_FILE;}
+    if (S_ISDIR(st.st_mode)) {return DIRECTORY_ENTRY_DIRECTORY;}
+    return DIRECTORY_ENTRY_OTHER;
+}
+
+static u8 is_dot(const char* name) {
+    return name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+}
+
+// Depth-first walk of the directory 'name' in parent. 'leave' is called for that directory
+// itself only if report_top is set.
+static u8 walk_subtree(stack_alloc* alloc, file_t parent, string name, u32 depth, const directory_walk_callbacks* callbacks, u8 report_top) {
+    void* begin = alloc->cursor;
+    walk_level* top = push_level(alloc, 0, parent, name, depth);
+    if (!top->dir) {
+        sa_free(alloc, begin);
+        return 0;
+    }
+
+    while (top) {
+        const file_t top_fd = dirfd(top->dir);
+        struct dirent* d = readdir(top->dir);
+        if (!d) {
+            walk_level* done = top;
+            top = top->previous;
+            closedir(done->dir);
+            if (callbacks->leave && (top || report_top)) {
+                const directory_entry entry = {top ? dirfd(top->dir) : parent, done->name, DIRECTORY_ENTRY_DIRECTORY, done->depth};
+                callbacks->leave(&entry, callbacks->user);
+            }
+            sa_free(alloc, done);
+            continue;
+        }
+        if (is_dot(d->d_name)) {
+            continue;
+        }
+
+        const directory_entry entry = {
+            top_fd,
+            {d->d_name, byteoffset(d->d_name, mem_cstrlen(d->d_name))},
+            entry_type(top_fd, d),
+            top->depth + 1
+        };
+        const u8 descend = callbacks->visit ? callbacks->visit(&entry, callbacks->user) : 1;
+        if (entry.type == DIRECTORY_ENTRY_DIRECTORY && descend) {
+            walk_level* next = push_level(alloc, top, top_fd, entry.name, entry.depth);
+            if (next->dir) {
+                top = next;
+            } else {
+                sa_free(alloc, next);
+            }
+        }
+    }
+
+    debug_assert(alloc->cursor == begin);
+    return 1;
+}
+
+typedef struct {
+    file_t root;
+    string* subtrees_begin;
+    string* subtrees_end;
+    uptr next;                  // Index of the next subtree to walk, shared by the workers
+    const directory_walk_callbacks* callbacks;
+} walk_shared;
+
+static void* walk_worker(void* arg) {
+    walk_shared* shared = arg;
+    void* memory = mem_map(WORKER_MEMORY_SIZE);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, WORKER_MEMORY_SIZE));
+
+    const uptr count = (uptr)(shared->subtrees_end - shared->subtrees_begin);
+    for (uptr i = __atomic_fetch_add(&shared->next, 1, __ATOMIC_RELAXED); i < count; i = __atomic_fetch_add(&shared->next, 1, __ATOMIC_RELAXED)) {
+        walk_subtree(&alloc, shared->root, shared->subtrees_begin[i], 1, shared->callbacks, 1);
+    }
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, WORKER_MEMORY_SIZE);
+    return 0;
+}
+
+// Walk the root entries on the calling thread and hand the subdirectories over to the workers
+static u8 walk_parallel(stack_alloc* alloc, string path, const directory_walk_callbacks* callbacks, u32 thread_count) {
+    void* begin = alloc->cursor;
+    walk_level* root = push_level(alloc, 0, AT_FDCWD, path, 0);
+    if (!root->dir) {
+        sa_free(alloc, begin);
+        return 0;
+    }
+    const file_t root_fd = dirfd(root->dir);
+
+    // Names of the subdirectories to walk, copied as the dirent buffer is reused
+    void* names_begin = alloc->cursor;
+    uptr subtree_count = 0;
+    for (struct dirent* d = readdir(root->dir); d; d = readdir(root->dir)) {
+        if (is_dot(d->d_name)) {
+            continue;
+        }
+        const directory_entry entry = {
+            root_fd,
+            {d->d_name, byteoffset(d->d_name, mem_cstrlen(d->d_name))},
+            entry_type(root_fd, d),
+            1
+        };
+        const u8 descend = callbacks->visit ? callbacks->visit(&entry, callbacks->user) : 1;
+        if (entry.type == DIRECTORY_ENTRY_DIRECTORY && descend) {
+            sa_alloc_copy(alloc, entry.name.begin, byteoffset(entry.name.end, 1));
+            subtree_count += 1;
+        }
+    }
+    void* names_end = alloc->cursor;
+
+    sa_alloc(alloc, (uptr)(-(uptr)alloc->cursor & (sizeof(void*) - 1)));
+    string* subtrees = sa_alloc(alloc, sizeof(*subtrees) * subtree_count);
+    u8* name = names_begin;
+    for (uptr i = 0; i < subtree_count; ++i) {
+        subtrees[i].begin = name;
+        subtrees[i].end = byteoffset(name, mem_cstrlen(name));
+        name = byteoffset(subtrees[i].end, 1);
+    }
+    debug_assert((void*)name == names_end);
+    unused(names_end);
+
+    walk_shared shared = {root_fd, subtrees, subtrees + subtree_count, 0, callbacks};
+    if (thread_count > subtree_count) {
+        thread_count = subtree_count > 0 ? (u32)subtree_count : 1;
+    }
+    pthread_t* threads = sa_alloc(alloc, sizeof(*threads) * thread_count);
+    u32 started = 0;
+    for (u32 i = 1; i < thread_count; ++i) {
+        if (pthread_create(&threads[started], 0, walk_worker, &shared) == 0) {
+            started += 1;
+        }
+    }
+    walk_worker(&shared);
+    for (u32 i = 0; i < started; ++i) {
+        pthread_join(threads[i], 0);
+    }
+
+    closedir(root->dir);
+    sa_free(alloc, begin);
+    return 1;
+}
+
+u8 directory_walk(stack_alloc* alloc, const u8* path_begin, const u8* path_end, directory_walk_callbacks callbacks, u32 thread_count) {
+    const string path = {path_begin, path_end};
+    if (thread_count > 1) {
+        return walk_parallel(alloc, path, &callbacks, thread_count);
+    }
+    return walk_subtree(alloc, AT_FDCWD, path, 0, &callbacks, 0);
+}
+
+static u8 remove_visit(const directory_entry* entry, void* user) {
+    unused(user);
+    if (entry->type != DIRECTORY_ENTRY_DIRECTORY) {
+        unlinkat(entry->parent, entry->name.begin, 0);
+    }
+    return 1;
+}
+
+static void remove_leave(const directory_entry* entry, void* user) {
+    unused(user);
+    unlinkat(entry->parent, entry->name.begin, AT_REMOVEDIR);
+}
+
+void directory_walk_remove(stack_alloc* alloc, const u8* path_begin, const u8* path_end, u32 thread_count) {
+    const directory_walk_callbacks callbacks = {remove_visit, remove_leave, 0};
+    const u8 is_directory = directory_walk(alloc, path_begin, path_end, callbacks, thread_count);
+
+    const uptr path_size = bytesize(path_begin, path_end);
+    u8* path = sa_alloc(alloc, path_size + 1);
+    sa_copy(alloc, path_begin, path, path_size);
+    path[path_size] = '\0';
+    unlinkat(AT_FDCWD, (const char*)path, is_directory ? AT_REMOVEDIR : 0);
+    sa_free(alloc, path);
+}
@@ -0,0 +1,54 @@
+#ifndef DIRECTORY_WALK_H
+#define DIRECTORY_WALK_H
+
+#include "primitive.h"
+#include "litteral.h"
+#include "stack_alloc.h"
+#include "file.h"
+
+// Recursive directory walker
+//
+// Entries are opened relative to their parent directory descriptor, so no path is ever rebuilt,
+// and the entry type comes from the directory listing when the file system provides it (stat is
+// only issued otherwise). Symbolic links are reported as DIRECTORY_ENTRY_OTHER and never
+// followed.
+//
+// With thread_count > 1, the subdirectories directly under the root are distributed over
+// thread_count threads (the calling thread included), callbacks are then called concurrently.
+//
+// Example usage:
+//   static u8 count_files(const directory_entry* entry, void* user) {
+//       if (entry->type == DIRECTORY_ENTRY_FILE) {__atomic_fetch_add((uptr*)user, 1, __ATOMIC_RELAXED);}
+//       return 1;
+//   }
+//   uptr count = 0;
+//   directory_walk(alloc, path.begin, path.end, (directory_walk_callbacks){count_files, 0, &count}, 4);
+
+typedef enum {
+    DIRECTORY_ENTRY_FILE,
+    DIRECTORY_ENTRY_DIRECTORY,
+    DIRECTORY_ENTRY_OTHER
+} directory_entry_type;
+
+typedef struct {
+    file_t parent;              // Open descriptor of the directory containing the entry
+    string name;                // Entry name, followed by a NUL byte
+    directory_entry_type type;
+    u32 depth;                  // 1 for entries directly under the root
+} directory_entry;
+
+typedef struct {
+    // Called for every entry, before the content of a directory. Returning 0 skips the directory content.
+    u8 (*visit)(const directory_entry* entry, void* user);
+    // Called for every directory once its content has been walked (optional).
+    void (*leave)(const directory_entry* entry, void* user);
+    void* user;
+} directory_walk_callbacks;
+
+// Walk the entries under path, the root itself is not reported. Returns 0 if path is not a readable directory.
+u8 directory_walk(stack_alloc* alloc, const u8* path_begin, const u8* path_end, directory_walk_callbacks callbacks, u32 thread_count);
+
+// Remove path and everything under it. path may also be a single file.
+void directory_walk_remove(stack_alloc* alloc, const u8* path_begin, const u8* path_end, u32 thread_count);
+
+#endif /* DIRECTORY_WALK_H */
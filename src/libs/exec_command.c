@@ -1,33 +1,249 @@
 
 #include "exec_command.h"
+#include "mem.h"
+#include "assert.h"
+#include "system_time.h"
+#include "convert.h"
 
 #include <sys/wait.h>
+#include <sys/resource.h>
+#include <signal.h>
 #include <unistd.h>
+#include <spawn.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <errno.h>
+#include <pthread.h>
+
+// Printed by the shell after each command, followed by the exit code and a newline
+#define EXEC_MARKER "__END__ "
+#define EXEC_MARKER_SIZE 8
+// Smallest read, when less is left the end of the output is overwritten
+#define EXEC_READ_MIN 4096
+
+// Declared by <unistd.h> with _GNU_SOURCE only
+extern char** environ;
+
+static u64 exec_deadline_ms(i32 timeout_ms) {
+    return timeout_ms >= 0 ? sys_time_ms() + (u64)timeout_ms : 0;
+}
+
+// Wait until fd is readable or deadline_ms (sys_time_ms, no limit if 0) passed. Returns 0 on
+// timeout, errors are left to the next read.
+static u8 exec_wait_readable(int fd, u64 deadline_ms) {
+    while (1) {
+        int wait_ms = -1;
+        if (deadline_ms) {
+            const u64 now_ms = sys_time_ms();
+            wait_ms = deadline_ms > now_ms ? (int)(deadline_ms - now_ms) : 0;
+        }
+        struct pollfd pfd = {.fd = fd, .events = POLLIN};
+        const int ready = poll(&pfd, 1, wait_ms);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        return ready != 0;
+    }
+}
+
+// Process groups of the running shells and programs. They are not the foreground group of the
+// terminal, so SIGINT, SIGTERM and SIGHUP are forwarded to them before the process terminates.
+#define EXEC_MAX_GROUPS 256
+static i32 exec_groups[EXEC_MAX_GROUPS];
+static pthread_once_t exec_forward_once = PTHREAD_ONCE_INIT;
+static const int exec_forwarded_signals[] = {SIGINT, SIGTERM, SIGHUP};
+
+static void exec_forward_signal(int signal_number) {
+    for (u32 i = 0; i < EXEC_MAX_GROUPS; ++i) {
+        const i32 group = __atomic_load_n(&exec_groups[i], __ATOMIC_RELAXED);
+        if (group > 0) {
+            kill(-group, signal_number);
+        }
+    }
+    // Blocked until the handler returns, the default action then terminates the process
+    signal(signal_number, SIG_DFL);
+    raise(signal_number);
+}
+
+// Only signals left to their default action, a handler of the program stays in place
+static void exec_forward_install(void) {
+    for (u32 i = 0; i < sizeof(exec_forwarded_signals) / sizeof(exec_forwarded_signals[0]); ++i) {
+        struct sigaction current;
+        if (sigaction(exec_forwarded_signals[i], 0, &current) != 0 || current.sa_handler != SIG_DFL) {
+            continue;
+        }
+        struct sigaction action;
+        __builtin_memset(&action, 0, sizeof(action));
+        action.sa_handler = exec_forward_signal;
+        sigemptyset(&action.sa_mask);
+        sigaction(exec_forwarded_signals[i], &action, 0);
+    }
+}
+
+static void exec_group_add(pid_t group) {
+    pthread_once(&exec_forward_once, exec_forward_install);
+    for (u32 i = 0; i < EXEC_MAX_GROUPS; ++i) {
+        i32 free_slot = 0;
+        if (__atomic_compare_exchange_n(&exec_groups[i], &free_slot, (i32)group, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+}
+
+static void exec_group_remove(pid_t group) {
+    for (u32 i = 0; i < EXEC_MAX_GROUPS; ++i) {
+        i32 expected = (i32)group;
+        if (__atomic_compare_exchange_n(&exec_groups[i], &expected, 0, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+}
+
+// Reap pid, returns its exit code, -1 if it did not exit normally. usage, if not 0, gets the
+// CPU time and resident set of pid and of the processes it waited for.
+static i32 exec_wait(pid_t pid, exec_command_usage* usage) {
+    int status = 0;
+    struct rusage rusage;
+    while (wait4(pid, &status, 0, &rusage) < 0) {
+        if (errno != EINTR) {
+            exec_group_remove(pid);
+            return -1;
+        }
+    }
+    exec_group_remove(pid);
+    if (usage) {
+        usage->user_us = (u64)rusage.ru_utime.tv_sec * 1000000 + (u64)rusage.ru_utime.tv_usec;
+        usage->system_us = (u64)rusage.ru_stime.tv_sec * 1000000 + (u64)rusage.ru_stime.tv_usec;
+        usage->max_rss_kb = (u64)rusage.ru_maxrss;
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static void exec_session_close(exec_command_session* session, exec_command_usage* usage);
+static exec_command_result exec_session_run(exec_command_session* session, const string cmd, i32 timeout_ms, u8 restart, stack_alloc* alloc);
 
 exec_command_result exec_command(const string cmd, stack_alloc* alloc) {
+    return exec_command_timeout(cmd, -1, alloc);
+}
+
+exec_command_result exec_command_timeout(const string cmd, i32 timeout_ms, stack_alloc* alloc) {
     void* begin = alloc->cursor;
     exec_command_session* session = open_persistent_shell(alloc);
-    exec_command_result result = command_session_exec_command(session, cmd, alloc);
-    close_persistent_shell(session);
+    // A shell killed on timeout is not replaced, there is no next command
+    exec_command_result result = exec_session_run(session, cmd, timeout_ms, 0, alloc);
+    if (!result.timed_out) {
+        // The shell waited for everything the command started
+        exec_session_close(session, &result.usage);
+    }
     sa_move_tail(alloc, result.output, begin);
     result.output = begin;
     return result;
 }
 
+exec_command_result exec_command_argv(const string* argv_begin, const string* argv_end, stack_alloc* alloc) {
+    return exec_command_argv_timeout(argv_begin, argv_end, -1, alloc);
+}
+
+exec_command_result exec_command_argv_timeout(const string* argv_begin, const string* argv_end, i32 timeout_ms, stack_alloc* alloc) {
+    void* begin = alloc->cursor;
+    exec_command_result result = {0};
+    result.output = begin;
+    result.exit_code = -1;
+    const u64 begin_ns = sys_time_monotonic_ns();
+    const u64 deadline_ms = exec_deadline_ms(timeout_ms);
+
+    // NUL terminated copies of the arguments
+    const uptr count = (uptr)(argv_end - argv_begin);
+    char** argv = sa_alloc(alloc, sizeof(*argv) * (count + 1));
+    for (uptr i = 0; i < count; ++i) {
+        argv[i] = sa_alloc_copy(alloc, argv_begin[i].begin, argv_begin[i].end);
+        *(char*)sa_alloc(alloc, 1) = 0;
+    }
+    argv[count] = 0;
+
+    int outpipe[2];
+    if (pipe(outpipe) != 0) {
+        sa_free(alloc, begin);
+        return result;
+    }
+    fcntl(outpipe[0], F_SETFD, FD_CLOEXEC);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+    posix_spawn_file_actions_adddup2(&actions, outpipe[1], STDOUT_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, outpipe[1], STDERR_FILENO);
+    posix_spawn_file_actions_addclose(&actions, outpipe[1]);
+    // In its own process group, killed with its children on timeout
+    posix_spawnattr_t attributes;
+    posix_spawnattr_init(&attributes);
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+    posix_spawnattr_setpgroup(&attributes, 0);
+    pid_t pid;
+    const int spawned = posix_spawnp(&pid, argv[0], &actions, &attributes, argv, environ);
+    posix_spawnattr_destroy(&attributes);
+    posix_spawn_file_actions_destroy(&actions);
+    close(outpipe[1]);
+    if (spawned != 0) {
+        close(outpipe[0]);
+        sa_free(alloc, begin);
+        return result;
+    }
+    exec_group_add(pid);
+
+    // Read after the arguments, moved over them once the program exited
+    void* output = alloc->cursor;
+    while (1) {
+        if (!exec_wait_readable(outpipe[0], deadline_ms)) {
+            kill(-pid, SIGKILL);
+            result.timed_out = 1;
+            break;
+        }
+        u8 discard[256];
+        const u8 full = alloc->cursor == alloc->end;
+        u8* buffer = full ? discard : (u8*)alloc->cursor;
+        const uptr capacity = full ? sizeof(discard) : bytesize(alloc->cursor, alloc->end);
+        const ssize_t size = read(outpipe[0], buffer, capacity);
+        if (size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (size <= 0) {
+            break;
+        }
+        if (!full) {
+            sa_alloc(alloc, (uptr)size);
+        }
+    }
+    close(outpipe[0]);
+
+    result.exit_code = exec_wait(pid, &result.usage);
+    result.usage.wall_us = (sys_time_monotonic_ns() - begin_ns) / 1000;
+    result.success = result.exit_code == 0;
+    sa_move_tail(alloc, output, begin);
+    return result;
+}
+
 struct exec_command_session {
     int in_fd;   // write commands here
     int out_fd;  // read results here
     pid_t pid;
+    u32 marker_matched;         // Bytes of the marker at the end of the output read so far
+    u8 marker_seen;             // The marker was read, the exit code follows
+    i32 exit_code;
 };
 
-exec_command_session* open_persistent_shell(stack_alloc* alloc) {
-    exec_command_session* session = sa_alloc(alloc, sizeof(*session));
+static void exec_session_open(exec_command_session* session) {
     *session = (exec_command_session){ .in_fd = -1, .out_fd = -1, .pid = -1 };
     int inpipe[2], outpipe[2];
-    if (pipe(inpipe) != 0 || pipe(outpipe) != 0) return session;
+    if (pipe(inpipe) != 0 || pipe(outpipe) != 0) return;
+    // Shells of a pool do not inherit the pipes of each other, dup2 clears the flag in the child
+    fcntl(inpipe[1], F_SETFD, FD_CLOEXEC);
+    fcntl(outpipe[0], F_SETFD, FD_CLOEXEC);
 
     pid_t pid = fork();
     if (pid == 0) {
+        // In its own process group, killed with the command it runs on timeout
+        setpgid(0, 0);
         dup2(inpipe[0], STDIN_FILENO);
         dup2(outpipe[1], STDOUT_FILENO);
         dup2(outpipe[1], STDERR_FILENO);
@@ -37,61 +253,375 @@ exec_command_session* open_persistent_shell(stack_alloc* alloc) {
         _exit(127);
     }
 
+    setpgid(pid, pid);
+    exec_group_add(pid);
     close(inpipe[0]);
     close(outpipe[1]);
     session->in_fd  = inpipe[1];
     session->out_fd = outpipe[0];
     session->pid    = pid;
+}
+
+// Writing to a shell that exited fails with EPIPE, the SIGPIPE it raises is blocked and dropped
+// instead of killing the process. The next read sees the end of the output.
+static void exec_session_write(exec_command_session* session, const u8* begin, const u8* end) {
+    sigset_t pipe_set, previous_set;
+    sigemptyset(&pipe_set);
+    sigaddset(&pipe_set, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipe_set, &previous_set);
+    u8 broken = 0;
+    while (begin < end) {
+        const ssize_t size = write(session->in_fd, begin, bytesize(begin, end));
+        if (size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (size <= 0) {
+            broken = size < 0 && errno == EPIPE;
+            break;
+        }
+        begin += size;
+    }
+    if (broken && !sigismember(&previous_set, SIGPIPE)) {
+        const struct timespec no_wait = {0, 0};
+        sigtimedwait(&pipe_set, 0, &no_wait);
+    }
+    pthread_sigmask(SIG_SETMASK, &previous_set, 0);
+}
+
+// Send cmd followed by the end marker of the command
+static void exec_session_send(exec_command_session* session, const string cmd) {
+    const string end_marker_command = STR("; echo " EXEC_MARKER "$?\n");
+    session->marker_matched = 0;
+    session->marker_seen = 0;
+    session->exit_code = -1;
+    exec_session_write(session, cmd.begin, cmd.end);
+    exec_session_write(session, end_marker_command.begin, end_marker_command.end);
+}
+
+// Move the output in [read, end) to out, without the marker line. Each byte is looked at once:
+// the part of a marker at the end of the data is held back until the next bytes tell whether it
+// is output, so out can be up to EXEC_MARKER_SIZE bytes before read. Returns the end of the
+// output, done is set once the marker line was read.
+static u8* exec_session_match(exec_command_session* session, const u8* read, const u8* end, u8* out, u8* done) {
+    static const char marker[] = EXEC_MARKER;
+    // Longest proper prefix of marker[0, n) that is also a suffix of it, by n
+    static const u8 fallback[EXEC_MARKER_SIZE] = {0, 0, 1, 0, 0, 0, 1, 2};
+
+    for (; read < end; ++read) {
+        const u8 c = *read;
+        if (session->marker_seen) {
+            if (c == '\n') {
+                *done = 1;
+                return out;
+            }
+            session->exit_code = session->exit_code * 10 + (c - '0');
+            continue;
+        }
+        u32 matched = session->marker_matched;
+        while (matched > 0 && c != (u8)marker[matched]) {
+            // The held back bytes not in the shorter match were output
+            const u32 kept = fallback[matched];
+            __builtin_memcpy(out, marker, matched - kept);
+            out += matched - kept;
+            matched = kept;
+        }
+        if (c == (u8)marker[matched]) {
+            matched += 1;
+            if (matched == EXEC_MARKER_SIZE) {
+                session->marker_seen = 1;
+                session->exit_code = 0;
+                matched = 0;
+            }
+        } else {
+            *out++ = c;
+        }
+        session->marker_matched = matched;
+    }
+    return out;
+}
+
+// Read what the shell wrote so far into [buffer, buffer_end), at least EXEC_MARKER_SIZE + 1
+// bytes, and set output_end to the end of the output in it. Returns 1 once the end marker line
+// of the command was read, session->exit_code is then set.
+static u8 exec_session_read(exec_command_session* session, u8* buffer, u8* buffer_end, u8** output_end) {
+    debug_assert(bytesize(buffer, buffer_end) > EXEC_MARKER_SIZE);
+    *output_end = buffer;
+    u8* read_begin = buffer + EXEC_MARKER_SIZE;
+    const ssize_t size = read(session->out_fd, read_begin, bytesize(read_begin, buffer_end));
+    if (size < 0 && errno == EINTR) {
+        return 0;
+    }
+    if (size <= 0) {
+        // The shell exited, a held back part of the marker was output
+        if (!session->marker_seen) {
+            __builtin_memcpy(buffer, EXEC_MARKER, session->marker_matched);
+            *output_end = buffer + session->marker_matched;
+        }
+        // The command ran exit or the shell was killed, a new shell takes the next command
+        close(session->in_fd);
+        close(session->out_fd);
+        const i32 exit_code = exec_wait(session->pid, 0);
+        exec_session_open(session);
+        session->exit_code = exit_code;
+        return 1;
+    }
+    u8 done = 0;
+    *output_end = exec_session_match(session, read_begin, read_begin + size, buffer, &done);
+    return done;
+}
+
+// exec_session_read to the end of the output starting at output_begin
+static u8 exec_session_read_alloc(exec_command_session* session, stack_alloc* alloc, void* output_begin) {
+    if (bytesize(alloc->cursor, alloc->end) < EXEC_READ_MIN && bytesize(output_begin, alloc->cursor) >= EXEC_READ_MIN) {
+        // Full, overwrite the end of the output
+        sa_free(alloc, byteoffset(alloc->cursor, -(iptr)EXEC_READ_MIN));
+    }
+    u8* output_end;
+    const u8 done = exec_session_read(session, alloc->cursor, alloc->end, &output_end);
+    sa_alloc(alloc, bytesize(alloc->cursor, output_end));
+    return done;
+}
+
+exec_command_session* open_persistent_shell(stack_alloc* alloc) {
+    exec_command_session* session = sa_alloc(alloc, sizeof(*session));
+    exec_session_open(session);
     return session;
 }
 
-exec_command_result command_session_exec_command(exec_command_session* session, const string cmd, stack_alloc* alloc) {
-    
-    exec_command_result result;
-    result.output = alloc->cursor;
-    result.success = 0;
+// CPU time the shell accounts for the children it waited for
+static void exec_session_children_cpu(const exec_command_session* session, u64* user_us, u64* system_us) {
+    *user_us = 0;
+    *system_us = 0;
+    char path[32] = "/proc/";
+    char* path_end = convert_u64_to_decimal((u64)session->pid, path + 6);
+    __builtin_memcpy(path_end, "/stat", 6);
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    char stat[512];
+    const ssize_t size = read(fd, stat, sizeof(stat));
+    close(fd);
+    if (size <= 0) {
+        return;
+    }
 
-    string command;
-    command.begin = alloc->cursor;
-    sa_alloc_copy(alloc, cmd.begin, cmd.end);
+    // Fields after the process name, which ends with the last ')': the state is the first,
+    // cutime and cstime the 14th and 15th
+    const char* c = stat + size;
+    while (c > stat && c[-1] != ')') {
+        --c;
+    }
+    u64 ticks[2] = {0, 0};
+    for (u32 field = 0; c < stat + size && field <= 15; ++c) {
+        if (*c == ' ') {
+            field += 1;
+        } else if (field >= 14 && *c >= '0' && *c <= '9') {
+            ticks[field - 14] = ticks[field - 14] * 10 + (u64)(*c - '0');
+        }
+    }
+    const u64 ticks_per_second = (u64)sysconf(_SC_CLK_TCK);
+    *user_us = ticks[0] * 1000000 / ticks_per_second;
+    *system_us = ticks[1] * 1000000 / ticks_per_second;
+}
 
-    const string end_marker_command = STR("; echo __END__ $?\n");
-    sa_alloc_copy(alloc, end_marker_command.begin, end_marker_command.end);
-    command.end = alloc->cursor;
+// Kill the shell with the command it runs
+static void exec_session_kill(exec_command_session* session) {
+    kill(-session->pid, SIGKILL);
+    close(session->in_fd);
+    close(session->out_fd);
+    exec_wait(session->pid, 0);
+    *session = (exec_command_session){ .in_fd = -1, .out_fd = -1, .pid = -1 };
+}
 
-    write(session->in_fd, command.begin, bytesize(command.begin, command.end));
-    fsync(session->in_fd);
+// Run cmd, on timeout the shell is killed and, with restart, a new one is started
+static exec_command_result exec_session_run(exec_command_session* session, const string cmd, i32 timeout_ms, u8 restart, stack_alloc* alloc) {
+    exec_command_result result = {0};
+    result.output = alloc->cursor;
+    const u64 begin_ns = sys_time_monotonic_ns();
+    const u64 deadline_ms = exec_deadline_ms(timeout_ms);
+    u64 user_us, system_us;
+    exec_session_children_cpu(session, &user_us, &system_us);
 
-    string out = {alloc->cursor, alloc->cursor};
+    exec_session_send(session, cmd);
     while (1) {
-        void* begin = alloc->cursor;
-        const uptr size = read(session->out_fd, alloc->cursor, bytesize(alloc->cursor, alloc->end));
-        alloc->cursor = byteoffset(alloc->cursor, size);
-        if (size > 0) {
-            const string end_marker = STR("__END__");
-            void* marker_start = sa_find(alloc, begin, alloc->cursor, end_marker.begin, end_marker.end);
-            if (marker_start) {
-                void* marker_end = byteoffset(marker_start, bytesize(end_marker.begin, end_marker.end));
-                u8* code_start = byteoffset(marker_end, 1);
-
-                sa_free(alloc, marker_start);
-                result.success = *code_start == '0';
-                break;
+        if (!exec_wait_readable(session->out_fd, deadline_ms)) {
+            // The wait4 totals of the shell cover all its commands, only the wall time is known
+            exec_session_kill(session);
+            if (restart) {
+                exec_session_open(session);
             }
+            result.timed_out = 1;
+            session->exit_code = -1;
+            break;
+        }
+        if (exec_session_read_alloc(session, alloc, result.output)) {
+            exec_session_children_cpu(session, &result.usage.user_us, &result.usage.system_us);
+            result.usage.user_us = result.usage.user_us > user_us ? result.usage.user_us - user_us : 0;
+            result.usage.system_us = result.usage.system_us > system_us ? result.usage.system_us - system_us : 0;
+            break;
         }
     }
-    
-    out.end = alloc->cursor;
-    
-    sa_move_tail(alloc, (void*)out.begin, (void*)command.begin);
+    result.usage.wall_us = (sys_time_monotonic_ns() - begin_ns) / 1000;
+    result.exit_code = session->exit_code;
+    result.success = result.exit_code == 0;
 
     return result;
 }
 
-void close_persistent_shell(exec_command_session* session) {
+exec_command_result command_session_exec_command(exec_command_session* session, const string cmd, stack_alloc* alloc) {
+    return command_session_exec_command_timeout(session, cmd, -1, alloc);
+}
+
+exec_command_result command_session_exec_command_timeout(exec_command_session* session, const string cmd, i32 timeout_ms, stack_alloc* alloc) {
+    return exec_session_run(session, cmd, timeout_ms, 1, alloc);
+}
+
+exec_command_result command_session_exec_command_stream(exec_command_session* session, const string cmd, exec_command_output_callback callback, void* context) {
+    u8 buffer[EXEC_MARKER_SIZE + EXEC_COMMAND_CHUNK_SIZE];
+    const u64 begin_ns = sys_time_monotonic_ns();
+    exec_session_send(session, cmd);
+    u8 done = 0;
+    while (!done) {
+        u8* output_end;
+        done = exec_session_read(session, buffer, buffer + sizeof(buffer), &output_end);
+        if (output_end != buffer) {
+            callback(context, (string){buffer, output_end});
+        }
+    }
+
+    exec_command_result result = {0};
+    result.usage.wall_us = (sys_time_monotonic_ns() - begin_ns) / 1000;
+    result.exit_code = session->exit_code;
+    result.success = result.exit_code == 0;
+    return result;
+}
+
+static void exec_session_close(exec_command_session* session, exec_command_usage* usage) {
     const string exit_command = STR("exit\n");
     write(session->in_fd, exit_command.begin, bytesize(exit_command.begin, exit_command.end));
     close(session->in_fd);
     close(session->out_fd);
-    waitpid(session->pid, NULL, 0);
+    exec_wait(session->pid, usage);
+}
+
+void close_persistent_shell(exec_command_session* session) {
+    exec_session_close(session, 0);
+}
+
+typedef enum {
+    EXEC_POOL_SHELL_IDLE,
+    EXEC_POOL_SHELL_RUNNING,
+    EXEC_POOL_SHELL_DONE             // Output not released yet
+} exec_pool_shell_state;
+
+typedef struct {
+    exec_command_session session;
+    stack_alloc output;
+    u32 id;
+    u8 state;
+} exec_pool_shell;
+
+struct exec_command_pool {
+    exec_pool_shell* shells;
+    u32 shell_count;
+    u32 last_id;
+};
+
+exec_command_pool* exec_command_pool_open(stack_alloc* alloc, u32 shell_count) {
+    exec_command_pool* pool = sa_alloc(alloc, sizeof(*pool));
+    pool->shells = sa_alloc(alloc, sizeof(*pool->shells) * shell_count);
+    pool->shell_count = shell_count;
+    pool->last_id = 0;
+    for (exec_pool_shell* shell = pool->shells; shell < pool->shells + shell_count; ++shell) {
+        exec_session_open(&shell->session);
+        void* memory = mem_map(EXEC_COMMAND_POOL_OUTPUT_SIZE);
+        sa_init(&shell->output, memory, byteoffset(memory, EXEC_COMMAND_POOL_OUTPUT_SIZE));
+        shell->id = 0;
+        shell->state = EXEC_POOL_SHELL_IDLE;
+    }
+    return pool;
+}
+
+void exec_command_pool_close(exec_command_pool* pool) {
+    // Shells still running a command exit once it is done
+    for (exec_pool_shell* shell = pool->shells; shell < pool->shells + pool->shell_count; ++shell) {
+        close_persistent_shell(&shell->session);
+        void* memory = shell->output.begin;
+        sa_deinit(&shell->output);
+        mem_unmap(memory, EXEC_COMMAND_POOL_OUTPUT_SIZE);
+    }
+}
+
+u32 exec_command_pool_submit(exec_command_pool* pool, const string cmd) {
+    for (exec_pool_shell* shell = pool->shells; shell < pool->shells + pool->shell_count; ++shell) {
+        if (shell->state != EXEC_POOL_SHELL_IDLE) {
+            continue;
+        }
+        pool->last_id = pool->last_id + 1 ? pool->last_id + 1 : 1;
+        shell->id = pool->last_id;
+        shell->state = EXEC_POOL_SHELL_RUNNING;
+        sa_free(&shell->output, shell->output.begin);
+        exec_session_send(&shell->session, cmd);
+        return shell->id;
+    }
+    return 0;
+}
+
+u8 exec_command_pool_poll(exec_command_pool* pool, i32 timeout_ms, exec_command_completion* completion) {
+    struct pollfd fds[EXEC_COMMAND_POOL_MAX_SHELLS];
+    exec_pool_shell* polled[EXEC_COMMAND_POOL_MAX_SHELLS];
+    debug_assert(pool->shell_count <= EXEC_COMMAND_POOL_MAX_SHELLS);
+    const u64 deadline_ms = timeout_ms >= 0 ? sys_time_ms() + (u64)timeout_ms : 0;
+
+    while (1) {
+        nfds_t count = 0;
+        for (exec_pool_shell* shell = pool->shells; shell < pool->shells + pool->shell_count; ++shell) {
+            if (shell->state == EXEC_POOL_SHELL_RUNNING) {
+                fds[count] = (struct pollfd){.fd = shell->session.out_fd, .events = POLLIN};
+                polled[count] = shell;
+                count += 1;
+            }
+        }
+        if (count == 0) {
+            return 0;
+        }
+
+        i32 wait_ms = timeout_ms;
+        if (timeout_ms >= 0) {
+            const u64 now_ms = sys_time_ms();
+            wait_ms = deadline_ms > now_ms ? (i32)(deadline_ms - now_ms) : 0;
+        }
+        const int ready = poll(fds, count, wait_ms);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            return 0;
+        }
+        for (nfds_t i = 0; i < count; ++i) {
+            if (!fds[i].revents) {
+                continue;
+            }
+            exec_pool_shell* shell = polled[i];
+            if (exec_session_read_alloc(&shell->session, &shell->output, shell->output.begin)) {
+                shell->state = EXEC_POOL_SHELL_DONE;
+                completion->id = shell->id;
+                completion->success = shell->session.exit_code == 0;
+                completion->exit_code = shell->session.exit_code;
+                completion->output = (string){shell->output.begin, shell->output.cursor};
+                return 1;
+            }
+        }
+    }
+}
+
+void exec_command_pool_release(exec_command_pool* pool, u32 id) {
+    for (exec_pool_shell* shell = pool->shells; shell < pool->shells + pool->shell_count; ++shell) {
+        if (shell->id == id && shell->state == EXEC_POOL_SHELL_DONE) {
+            shell->state = EXEC_POOL_SHELL_IDLE;
+            sa_free(&shell->output, shell->output.begin);
+            return;
+        }
+    }
 }
@@ -4,19 +4,110 @@
 #include "litteral.h"
 #include "stack_alloc.h"
 
+typedef struct {
+    u64 wall_us;
+    u64 user_us;                // CPU time of the command and the processes it waited for
+    u64 system_us;
+    u64 max_rss_kb;             // Largest resident set of one of them, 0 when not known
+} exec_command_usage;
+
 typedef struct {
     void* output;
     u8 success;
+    u8 timed_out;               // Killed after its timeout, with the processes it started
+    i32 exit_code;              // -1 if the command did not exit normally
+    exec_command_usage usage;
 } exec_command_result;
 
+/*
+    Shells and programs run in their own process group, killed as a whole on timeout. Since
+    that is not the foreground group of the terminal, SIGINT, SIGTERM and SIGHUP are forwarded
+    to the running groups before the process terminates, unless the program handles them.
+*/
+
 /*
     Execute a command. Returns a pointer in alloc that is the start of the result.
 */
 exec_command_result exec_command(const string cmd, stack_alloc* alloc);
+/*
+    exec_command killed after timeout_ms, no limit if negative. The usage is read with wait4.
+*/
+exec_command_result exec_command_timeout(const string cmd, i32 timeout_ms, stack_alloc* alloc);
 
+/*
+    Run the program argv_begin[0], searched in PATH, with the arguments [argv_begin, argv_end)
+    and no shell. The output (stdout and stderr) starts at the returned pointer in alloc, stdin
+    is /dev/null. The exit status and usage are read with wait4.
+*/
+exec_command_result exec_command_argv(const string* argv_begin, const string* argv_end, stack_alloc* alloc);
+exec_command_result exec_command_argv_timeout(const string* argv_begin, const string* argv_end, i32 timeout_ms, stack_alloc* alloc);
+
+/*
+    Commands of a session run one after the other in the same shell. Their CPU time is what the
+    shell accounts for its children (/proc/<pid>/stat, in clock ticks), their resident set is not
+    known. A command over its timeout is killed with the shell, which is started again, and
+    only its wall time is reported.
+*/
 typedef struct exec_command_session exec_command_session;
 exec_command_session* open_persistent_shell(stack_alloc* alloc);
 exec_command_result command_session_exec_command(exec_command_session* session, const string cmd, stack_alloc* alloc);
+exec_command_result command_session_exec_command_timeout(exec_command_session* session, const string cmd, i32 timeout_ms, stack_alloc* alloc);
 void close_persistent_shell(exec_command_session* session);
 
+// Largest chunk handed to an exec_command_output_callback
+#define EXEC_COMMAND_CHUNK_SIZE 4096
+typedef void (*exec_command_output_callback)(void* context, string chunk);
+
+/*
+    Run cmd and hand its output to callback as the shell writes it, in chunks of at most
+    EXEC_COMMAND_CHUNK_SIZE bytes read into a buffer on the stack. No output is kept, outputs of
+    any size run in constant memory. result.output is 0.
+*/
+exec_command_result command_session_exec_command_stream(exec_command_session* session, const string cmd, exec_command_output_callback callback, void* context);
+
+// Pool of persistent shells running commands in parallel
+//
+// A command is handed to an idle shell without waiting for it, exec_command_pool_poll waits with
+// poll() on the shells running a command and returns the next one to finish. The output of each
+// command is read into the arena of its shell, it stays valid until the command is released,
+// which makes the shell idle again. Outputs longer than EXEC_COMMAND_POOL_OUTPUT_SIZE keep their
+// beginning and their last few kilobytes.
+//
+// Example usage:
+//   exec_command_pool* pool = exec_command_pool_open(alloc, 4);
+//   exec_command_completion done;
+//   for (string* cmd = commands; cmd < commands_end;) {
+//       if (exec_command_pool_submit(pool, *cmd)) {
+//           ++cmd;
+//       } else if (exec_command_pool_poll(pool, -1, &done)) {
+//           exec_command_pool_release(pool, done.id);
+//       }
+//   }
+//   while (exec_command_pool_poll(pool, -1, &done)) {
+//       exec_command_pool_release(pool, done.id);
+//   }
+//   exec_command_pool_close(pool);
+#define EXEC_COMMAND_POOL_MAX_SHELLS 64
+// Bytes of address space reserved for the output of each shell, committed as it is written
+#define EXEC_COMMAND_POOL_OUTPUT_SIZE (16 * 1024 * 1024)
+
+typedef struct exec_command_pool exec_command_pool;
+
+typedef struct {
+    u32 id;
+    u8 success;
+    i32 exit_code;
+    string output;
+} exec_command_completion;
+
+exec_command_pool* exec_command_pool_open(stack_alloc* alloc, u32 shell_count);
+void exec_command_pool_close(exec_command_pool* pool);
+// Start cmd on an idle shell. Returns the id of the command, 0 if every shell is in use.
+u32 exec_command_pool_submit(exec_command_pool* pool, const string cmd);
+// Wait up to timeout_ms (no limit if negative) for a running command to finish. Returns 0 on
+// timeout or when no command is running.
+u8 exec_command_pool_poll(exec_command_pool* pool, i32 timeout_ms, exec_command_completion* completion);
+// Release the output of a finished command.
+void exec_command_pool_release(exec_command_pool* pool, u32 id);
+
 #endif /* EXEC_COMMAND_H */
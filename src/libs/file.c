@@ -1,11 +1,23 @@
 #include "file.h"
 #include "assert.h"
 #include "mem.h"
+#include "directory_walk.h"
+#include "hash_map.h"
+#include "convert.h"
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/stat.h>
+#include <linux/stat.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <errno.h>
-#include <dirent.h>
+#include <stdio.h> // rename
+#include <stdlib.h> // realpath
+#include <limits.h> // PATH_MAX
+#include <signal.h> // kill
+#include <pthread.h>
 
 file_t file_invalid(void) {
     return -1;
@@ -65,27 +77,184 @@ uptr file_read_all(file_t file, void** buffer, stack_alloc* alloc) {
         return 0;
     }
 
-    // Get file size
-    off_t file_size = lseek(file, 0, SEEK_END);
-    lseek(file, 0, SEEK_SET);
-
-    if (file_size <= 0) {
+    const uptr size = file_size(file);
+    if (size == 0) {
         return 0;
     }
 
     // Allocate buffer
-    *buffer = sa_alloc(alloc, (uptr)file_size);
+    *buffer = sa_alloc(alloc, size);
     if (!*buffer) {
         return 0;
     }
 
-    // Read entire file
-    ssize_t bytes_read = read(file, *buffer, (size_t)file_size);
-    if (bytes_read == file_invalid()) {
+    const uptr bytes_read = file_read_at(file, *buffer, byteoffset(*buffer, size), 0);
+    if (bytes_read == 0) {
+        sa_free(alloc, *buffer);
         return 0;
     }
-    debug_assert(file_size == bytes_read);
-    return (uptr)bytes_read;
+    if (bytes_read < size) {
+        // File shrunk while reading, give back the unused tail
+        sa_free(alloc, byteoffset(*buffer, bytes_read));
+    }
+    return bytes_read;
+}
+
+// Map the whole file read-only
+u8_slice file_map_readonly(file_t file) {
+    u8_slice mapping = {0, 0};
+    struct stat st;
+    if (file == file_invalid() || fstat(file, &st) != 0 || st.st_size <= 0) {
+        return mapping;
+    }
+
+    void* pointer = mmap(0, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (pointer == MAP_FAILED) {
+        return mapping;
+    }
+    // Content is usually consumed front to back right away
+    madvise(pointer, (size_t)st.st_size, MADV_SEQUENTIAL);
+    madvise(pointer, (size_t)st.st_size, MADV_WILLNEED);
+
+    mapping.begin = pointer;
+    mapping.end = byteoffset(pointer, st.st_size);
+    return mapping;
+}
+
+void file_unmap(u8_slice mapping) {
+    if (mapping.begin) {
+        munmap(mapping.begin, bytesize(mapping.begin, mapping.end));
+    }
+}
+
+struct file_stream {
+    file_t file;
+    file_stream_mode mode;
+    uptr chunk_size;
+    uptr offset;            // File offset of the next chunk to read
+    u8* chunks[2];
+    uptr sizes[2];
+    u8 ready[2];            // Chunk filled and not yet released by the consumer
+    u8 current;             // Chunk owned by the consumer
+    u8 holding;             // The consumer holds chunks[current]
+    u8 finished;            // End of file returned to the consumer
+    u8 stop;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+};
+
+// Fill a chunk, looping over short reads. Returns the number of bytes read, 0 at end of file.
+static uptr file_stream_read_chunk(file_stream* stream, u8* chunk) {
+    posix_fadvise(stream->file, (off_t)(stream->offset + stream->chunk_size), (off_t)stream->chunk_size, POSIX_FADV_WILLNEED);
+
+    const uptr size = file_read_at(stream->file, chunk, chunk + stream->chunk_size, stream->offset);
+    stream->offset += size;
+    return size;
+}
+
+static void* file_stream_background(void* arg) {
+    file_stream* stream = arg;
+    u8 slot = 0;
+    while (1) {
+        pthread_mutex_lock(&stream->mutex);
+        while (stream->ready[slot] && !stream->stop) {
+            pthread_cond_wait(&stream->cond, &stream->mutex);
+        }
+        const u8 stop = stream->stop;
+        pthread_mutex_unlock(&stream->mutex);
+        if (stop) {
+            break;
+        }
+
+        const uptr size = file_stream_read_chunk(stream, stream->chunks[slot]);
+
+        pthread_mutex_lock(&stream->mutex);
+        stream->sizes[slot] = size;
+        stream->ready[slot] = 1;
+        pthread_cond_broadcast(&stream->cond);
+        pthread_mutex_unlock(&stream->mutex);
+
+        if (size == 0) {
+            break;
+        }
+        slot ^= 1;
+    }
+    return 0;
+}
+
+file_stream* file_stream_init(stack_alloc* alloc, file_t file, uptr chunk_size, file_stream_mode mode) {
+    debug_assert(file != file_invalid());
+    debug_assert(chunk_size > 0);
+
+    u8* chunks = sa_alloc(alloc, chunk_size * 2);
+    file_stream* stream = sa_alloc(alloc, sizeof(*stream));
+    *stream = (file_stream){0};
+    stream->file = file;
+    stream->mode = mode;
+    stream->chunk_size = chunk_size;
+    stream->offset = (uptr)lseek(file, 0, SEEK_CUR);
+    stream->chunks[0] = chunks;
+    stream->chunks[1] = chunks + chunk_size;
+
+    posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    if (mode == FILE_STREAM_BACKGROUND) {
+        pthread_mutex_init(&stream->mutex, 0);
+        pthread_cond_init(&stream->cond, 0);
+        if (pthread_create(&stream->thread, 0, file_stream_background, stream) != 0) {
+            pthread_cond_destroy(&stream->cond);
+            pthread_mutex_destroy(&stream->mutex);
+            stream->mode = FILE_STREAM_SYNC;
+        }
+    }
+    return stream;
+}
+
+u8_slice file_stream_next(file_stream* stream) {
+    if (stream->finished) {
+        return (u8_slice){0, 0};
+    }
+
+    if (stream->mode == FILE_STREAM_SYNC) {
+        stream->current ^= 1;
+        u8* chunk = stream->chunks[stream->current];
+        const uptr size = file_stream_read_chunk(stream, chunk);
+        stream->finished = size == 0;
+        return stream->finished ? (u8_slice){0, 0} : (u8_slice){chunk, chunk + size};
+    }
+
+    pthread_mutex_lock(&stream->mutex);
+    if (stream->holding) {
+        // Give the previous chunk back to the reader
+        stream->ready[stream->current] = 0;
+        stream->current ^= 1;
+        pthread_cond_broadcast(&stream->cond);
+    }
+    while (!stream->ready[stream->current]) {
+        pthread_cond_wait(&stream->cond, &stream->mutex);
+    }
+    stream->holding = 1;
+    const uptr size = stream->sizes[stream->current];
+    pthread_mutex_unlock(&stream->mutex);
+
+    u8* chunk = stream->chunks[stream->current];
+    stream->finished = size == 0;
+    return stream->finished ? (u8_slice){0, 0} : (u8_slice){chunk, chunk + size};
+}
+
+void file_stream_deinit(stack_alloc* alloc, file_stream* stream) {
+    debug_assert(byteoffset(stream, sizeof(*stream)) == alloc->cursor);
+    if (stream->mode == FILE_STREAM_BACKGROUND) {
+        pthread_mutex_lock(&stream->mutex);
+        stream->stop = 1;
+        pthread_cond_broadcast(&stream->cond);
+        pthread_mutex_unlock(&stream->mutex);
+        pthread_join(stream->thread, 0);
+        pthread_cond_destroy(&stream->cond);
+        pthread_mutex_destroy(&stream->mutex);
+    }
+    sa_free(alloc, stream->chunks[0]);
 }
 
 // Write data to file
@@ -98,21 +267,413 @@ uptr file_write(file_t file, const void* begin, const void* end) {
     return (uptr)bytes_written;
 }
 
-// Get file size
-uptr file_size(file_t file) {
-    // Save current position
-    off_t current_pos = lseek(file, 0, SEEK_CUR);
+uptr file_read_at(file_t file, void* begin, void* end, uptr offset) {
+    uptr size = 0;
+    while (size < bytesize(begin, end)) {
+        ssize_t result = pread(file, byteoffset(begin, size), bytesize(begin, end) - size, (off_t)(offset + size));
+        if (result == file_invalid() && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            break;
+        }
+        size += (uptr)result;
+    }
+    return size;
+}
+
+uptr file_write_at(file_t file, const void* begin, const void* end, uptr offset) {
+    uptr size = 0;
+    while (size < bytesize(begin, end)) {
+        ssize_t result = pwrite(file, byteoffset(begin, size), bytesize(begin, end) - size, (off_t)(offset + size));
+        if (result == file_invalid() && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            break;
+        }
+        size += (uptr)result;
+    }
+    return size;
+}
+
+// iovec entries handed to the kernel per syscall
+#define FILE_VECTOR_BATCH 64
+
+typedef enum {
+    VECTOR_READ_AT,
+    VECTOR_WRITE,
+    VECTOR_WRITE_AT
+} vector_op;
+
+// Transfer the slices in batches of iovecs, resuming after partial transfers
+static uptr transfer_vector(file_t file, const u8_slice* slices_begin, const u8_slice* slices_end, uptr offset, vector_op op) {
+    struct iovec iov[FILE_VECTOR_BATCH];
+    uptr total = 0;
+    const u8_slice* slice = slices_begin;
+    uptr slice_done = 0;            // Bytes of *slice already transferred
+    while (slice < slices_end) {
+        i32 count = 0;
+        uptr requested = 0;
+        for (const u8_slice* s = slice; s < slices_end && count < FILE_VECTOR_BATCH; ++s) {
+            const uptr skip = s == slice ? slice_done : 0;
+            iov[count].iov_base = s->begin + skip;
+            iov[count].iov_len = bytesize(s->begin, s->end) - skip;
+            requested += iov[count].iov_len;
+            count += 1;
+        }
+
+        ssize_t result;
+        switch (op) {
+            case VECTOR_READ_AT: result = preadv(file, iov, count, (off_t)(offset + total)); break;
+            case VECTOR_WRITE: result = writev(file, iov, count); break;
+            default: result = pwritev(file, iov, count, (off_t)(offset + total)); break;
+        }
+        if (result == file_invalid() && errno == EINTR) {
+            continue;
+        }
+        if (result < 0 || (result == 0 && requested > 0)) {
+            break;
+        }
+        total += (uptr)result;
+
+        // Move past the fully transferred slices
+        uptr remaining = (uptr)result;
+        while (slice < slices_end && remaining >= bytesize(slice->begin, slice->end) - slice_done) {
+            remaining -= bytesize(slice->begin, slice->end) - slice_done;
+            slice_done = 0;
+            ++slice;
+        }
+        slice_done += remaining;
+    }
+    return total;
+}
+
+uptr file_read_vector_at(file_t file, const u8_slice* slices_begin, const u8_slice* slices_end, uptr offset) {
+    return transfer_vector(file, slices_begin, slices_end, offset, VECTOR_READ_AT);
+}
+
+uptr file_write_vector(file_t file, const u8_slice* slices_begin, const u8_slice* slices_end) {
+    return transfer_vector(file, slices_begin, slices_end, 0, VECTOR_WRITE);
+}
+
+uptr file_write_vector_at(file_t file, const u8_slice* slices_begin, const u8_slice* slices_end, uptr offset) {
+    return transfer_vector(file, slices_begin, slices_end, offset, VECTOR_WRITE_AT);
+}
+
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, i32)
+#endif
+
+// Size of the stack buffer of the file_copy fallback
+#define FILE_COPY_BUFFER_SIZE (64 * 1024)
+
+uptr file_copy(file_t destination, file_t source) {
+    const uptr size = file_size(source);
+
+    // A clone leaves the destination bytes past the end of source in place, start empty
+    if (ftruncate(destination, 0) != 0) {
+        return 0;
+    }
+
+    // Share the extents when the file system supports it, the copy is then O(1)
+    if (ioctl(destination, FICLONE, source) == 0) {
+        return size;
+    }
+
+    uptr copied = 0;
+    while (copied < size) {
+        // glibc only declares copy_file_range with _GNU_SOURCE
+        i64 source_offset = (i64)copied;
+        i64 destination_offset = (i64)copied;
+        const long result = syscall(SYS_copy_file_range, source, &source_offset, destination, &destination_offset, size - copied, 0);
+        if (result == file_invalid() && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            break;
+        }
+        copied += (uptr)result;
+    }
+
+    // Not supported between these files (e.g. across file systems on older kernels)
+    u8 buffer[FILE_COPY_BUFFER_SIZE];
+    while (copied < size) {
+        const uptr chunk = size - copied < sizeof(buffer) ? size - copied : sizeof(buffer);
+        const uptr read = file_read_at(source, buffer, buffer + chunk, copied);
+        if (read == 0 || file_write_at(destination, buffer, buffer + read, copied) != read) {
+            break;
+        }
+        copied += read;
+    }
+
+    ftruncate(destination, (off_t)copied);
+    return copied;
+}
+
+void file_sync_batch_init(file_sync_batch* batch) {
+    batch->count = 0;
+    batch->pending = 0;
+    void* memory = mem_map(FILE_SYNC_BATCH_PATHS_SIZE);
+    sa_init(&batch->renames, memory, byteoffset(memory, FILE_SYNC_BATCH_PATHS_SIZE));
+}
+
+// Make the directory entry of path durable, path is restored before returning
+static void sync_parent_directory(char* path) {
+    char* slash = 0;
+    for (char* c = path; *c; ++c) {
+        if (*c == '/') {
+            slash = c;
+        }
+    }
+    i32 directory;
+    if (!slash) {
+        directory = open(".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    } else if (slash == path) {
+        directory = open("/", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    } else {
+        *slash = '\0';
+        directory = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        *slash = '/';
+    }
+    if (directory >= 0) {
+        fsync(directory);
+        close(directory);
+    }
+}
+
+// Length of the directory part of path, up to its last '/'
+static uptr path_parent_size(const char* path) {
+    uptr size = 0;
+    for (uptr i = 0; path[i]; ++i) {
+        if (path[i] == '/') {
+            size = i;
+        }
+    }
+    return size;
+}
+
+// Group commit of the pending renames, the batch stays usable
+static u8 file_sync_batch_flush(file_sync_batch* batch) {
+    // The content of every temporary file reaches the disk before any destination is replaced
+    for (u32 i = 0; i < batch->count; ++i) {
+        syscall(SYS_syncfs, batch->files[i]);
+        close(batch->files[i]);
+    }
+    batch->count = 0;
+    batch->pending = 0;
+
+    u8 success = 1;
+    char* begin = batch->renames.begin;
+    char* end = batch->renames.cursor;
+    for (char* temp_path = begin; temp_path < end;) {
+        char* path = temp_path + mem_cstrlen(temp_path) + 1;
+        if (rename(temp_path, path) != 0) {
+            unlink(temp_path);
+            success = 0;
+        }
+        temp_path = path + mem_cstrlen(path) + 1;
+    }
+
+    // Then the directory entries, once per directory when they follow each other
+    const char* synced = 0;
+    uptr synced_size = 0;
+    for (char* temp_path = begin; temp_path < end;) {
+        char* path = temp_path + mem_cstrlen(temp_path) + 1;
+        const uptr parent_size = path_parent_size(path);
+        if (!synced || parent_size != synced_size || !sa_equals(&batch->renames, path, path + parent_size, synced, synced + synced_size)) {
+            sync_parent_directory(path);
+            synced = path;
+            synced_size = parent_size;
+        }
+        temp_path = path + mem_cstrlen(path) + 1;
+    }
+    sa_free(&batch->renames, begin);
+    return success;
+}
+
+u8 file_sync_batch_commit(file_sync_batch* batch) {
+    const u8 success = file_sync_batch_flush(batch);
+    void* memory = batch->renames.begin;
+    sa_deinit(&batch->renames);
+    mem_unmap(memory, FILE_SYNC_BATCH_PATHS_SIZE);
+    return success;
+}
+
+// Keep file open until the batch commit if its file system is not in the batch yet.
+// Returns 0 when the file has not been kept.
+static u8 file_sync_batch_add(file_sync_batch* batch, file_t file) {
+    struct stat st;
+    if (fstat(file, &st) != 0) {
+        return 0;
+    }
+    for (u32 i = 0; i < batch->count; ++i) {
+        if (batch->devices[i] == (u64)st.st_dev) {
+            return 0;
+        }
+    }
+    if (batch->count == FILE_SYNC_BATCH_CAPACITY) {
+        // Too many file systems, flush this one now, its rename still waits for the batch commit
+        syscall(SYS_syncfs, file);
+        return 0;
+    }
+    batch->files[batch->count] = file;
+    batch->devices[batch->count] = (u64)st.st_dev;
+    batch->count += 1;
+    return 1;
+}
+
+struct file_atomic {
+    file_t file;
+    char* path;         // Destination, NUL terminated
+    char* temp_path;    // path.<pid>.tmp, NUL terminated
+};
+
+file_atomic* file_atomic_open(stack_alloc* alloc, const u8* path_begin, const u8* path_end) {
+    file_atomic* atomic = sa_alloc(alloc, sizeof(*atomic));
+    uptr path_size = bytesize(path_begin, path_end);
+
+    atomic->path = sa_alloc(alloc, path_size + 1);
+    sa_copy(alloc, path_begin, atomic->path, path_size);
+    atomic->path[path_size] = '\0';
+
+    // A symbolic link stays in place, the file it points to is replaced
+    struct stat st;
+    char resolved[PATH_MAX];
+    if (lstat(atomic->path, &st) == 0 && S_ISLNK(st.st_mode) && realpath(atomic->path, resolved)) {
+        const uptr resolved_size = mem_cstrlen(resolved);
+        atomic->path = sa_alloc_copy(alloc, resolved, resolved + resolved_size + 1);
+        path_size = resolved_size;
+    }
+
+    // The process id keeps concurrent writers of the same destination apart
+    atomic->temp_path = sa_alloc(alloc, path_size + 1);
+    sa_copy(alloc, atomic->path, atomic->temp_path, path_size);
+    atomic->temp_path[path_size] = '.';
+    convert_u32_to_string((u32)getpid(), alloc);
+    const char suffix[] = ".tmp";
+    sa_alloc_copy(alloc, suffix, suffix + sizeof(suffix));
+
+    atomic->file = open(atomic->temp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (atomic->file == file_invalid()) {
+        sa_free(alloc, atomic);
+        return 0;
+    }
+    // The replaced file keeps its permissions
+    if (stat(atomic->path, &st) == 0) {
+        fchmod(atomic->file, st.st_mode & 07777);
+    }
+    return atomic;
+}
+
+file_t file_atomic_file(file_atomic* atomic) {
+    return atomic->file;
+}
+
+u8 file_atomic_commit(stack_alloc* alloc, file_atomic* atomic, file_sync_batch* batch) {
+    if (batch) {
+        const uptr temp_size = mem_cstrlen(atomic->temp_path) + 1;
+        const uptr path_size = mem_cstrlen(atomic->path) + 1;
+        if (temp_size + path_size > bytesize(batch->renames.cursor, batch->renames.end)) {
+            file_sync_batch_flush(batch);
+        }
+        if (temp_size + path_size <= bytesize(batch->renames.cursor, batch->renames.end)) {
+            sa_alloc_copy(&batch->renames, atomic->temp_path, atomic->temp_path + temp_size);
+            sa_alloc_copy(&batch->renames, atomic->path, atomic->path + path_size);
+            if (!file_sync_batch_add(batch, atomic->file)) {
+                close(atomic->file);
+            }
+            sa_free(alloc, atomic);
+            batch->pending += 1;
+            return batch->pending < FILE_SYNC_BATCH_MAX_RENAMES || file_sync_batch_flush(batch);
+        }
+    }
+
+    fsync(atomic->file);
+    if (rename(atomic->temp_path, atomic->path) != 0) {
+        file_atomic_abort(alloc, atomic);
+        return 0;
+    }
+    close(atomic->file);
+    sync_parent_directory(atomic->path);
+    sa_free(alloc, atomic);
+    return 1;
+}
+
+void file_atomic_abort(stack_alloc* alloc, file_atomic* atomic) {
+    close(atomic->file);
+    unlink(atomic->temp_path);
+    sa_free(alloc, atomic);
+}
+
+// Remove name if it is <destination>.<pid>.tmp and pid is not running
+static u8 atomic_cleanup_visit(const directory_entry* entry, void* user) {
+    unused(user);
+    const char suffix[] = ".tmp";
+    const char* name = entry->name.begin;
+    const char* digits_end = (const char*)entry->name.end - (sizeof(suffix) - 1);
+    if (entry->type != DIRECTORY_ENTRY_FILE || digits_end <= name
+        || __builtin_memcmp(digits_end, suffix, sizeof(suffix) - 1) != 0) {
+        return 1;
+    }
+    const char* digits = digits_end;
+    while (digits > name && digits[-1] >= '0' && digits[-1] <= '9') {
+        --digits;
+    }
+    if (digits == digits_end || digits == name || digits[-1] != '.') {
+        return 1;
+    }
+    u64 pid = 0;
+    for (const char* c = digits; c < digits_end; ++c) {
+        pid = pid * 10 + (u64)(*c - '0');
+    }
+    if (pid > 0 && pid <= 0x7fffffff && kill((pid_t)pid, 0) != 0 && errno == ESRCH) {
+        unlinkat(entry->parent, name, 0);
+    }
+    return 1;
+}
+
+void file_atomic_cleanup(stack_alloc* alloc, const u8* directory_begin, const u8* directory_end) {
+    directory_walk(alloc, directory_begin, directory_end, (directory_walk_callbacks){atomic_cleanup_visit, 0, 0}, 1);
+}
+
+void file_writer_init(file_writer* writer, file_t file, void* buffer_begin, void* buffer_end) {
+    writer->file = file;
+    writer->begin = buffer_begin;
+    writer->cursor = buffer_begin;
+    writer->end = buffer_end;
+}
 
-    // Get file size
-    off_t size = lseek(file, 0, SEEK_END);
+void file_writer_write(file_writer* writer, const void* begin, const void* end) {
+    const uptr size = bytesize(begin, end);
+    if (size <= bytesize(writer->cursor, writer->end)) {
+        __builtin_memcpy(writer->cursor, begin, size);
+        writer->cursor = byteoffset(writer->cursor, size);
+        return;
+    }
+
+    // Does not fit: send the pending bytes and the new data in one syscall
+    const u8_slice slices[2] = {{writer->begin, writer->cursor}, {(u8*)begin, (u8*)end}};
+    file_write_vector(writer->file, slices, slices + 2);
+    writer->cursor = writer->begin;
+}
 
-    // Restore position
-    lseek(file, current_pos, SEEK_SET);
+void file_writer_flush(file_writer* writer) {
+    if (writer->cursor == writer->begin) {
+        return;
+    }
+    const u8_slice slice = {writer->begin, writer->cursor};
+    file_write_vector(writer->file, &slice, &slice + 1);
+    writer->cursor = writer->begin;
+}
 
-    if (size == -1) {
+// Get file size
+uptr file_size(file_t file) {
+    struct stat st;
+    if (fstat(file, &st) != 0) {
         return 0;
     }
-    return (uptr)size;
+    return (uptr)st.st_size;
 }
 
 // Get modification time (milliseconds since epoch) for an open file handle.
@@ -138,6 +699,112 @@ uptr file_modification_time(file_t file) {
     return millis;
 }
 
+static file_metadata metadata_from_c_path(const char* path) {
+    file_metadata metadata = {0, 0, 0};
+    struct statx stx;
+    // Flags 0 is AT_STATX_SYNC_AS_STAT, only declared by libc with _GNU_SOURCE
+    if (syscall(SYS_statx, AT_FDCWD, path, 0, STATX_MTIME | STATX_SIZE, &stx) != 0) {
+        return metadata;
+    }
+    metadata.modification_time = (uptr)stx.stx_mtime.tv_sec * 1000ULL + (uptr)(stx.stx_mtime.tv_nsec / 1000000U);
+    metadata.size = (uptr)stx.stx_size;
+    metadata.exists = 1;
+    return metadata;
+}
+
+file_metadata file_metadata_path(stack_alloc* alloc, string path) {
+    const uptr path_size = bytesize(path.begin, path.end);
+    u8* c_path = sa_alloc(alloc, path_size + 1);
+    sa_copy(alloc, path.begin, c_path, path_size);
+    c_path[path_size] = '\0';
+    const file_metadata metadata = metadata_from_c_path((const char*)c_path);
+    sa_free(alloc, c_path);
+    return metadata;
+}
+
+// Average path size reserved per cached entry, the memory is only committed when used
+#define METADATA_CACHE_PATH_SIZE 256
+
+typedef struct {
+    file_metadata metadata;
+    u8 valid;
+} metadata_cache_entry;
+
+// Query path through a local buffer, the cache memory is only used for what it keeps
+static file_metadata metadata_cache_query(string path) {
+    u8 c_path[4096];
+    const uptr path_size = bytesize(path.begin, path.end);
+    if (path_size >= sizeof(c_path)) {
+        return (file_metadata){0, 0, 0};
+    }
+    __builtin_memcpy(c_path, path.begin, path_size);
+    c_path[path_size] = '\0';
+    return metadata_from_c_path((const char*)c_path);
+}
+
+struct file_metadata_cache {
+    void* memory;
+    uptr memory_size;
+    stack_alloc alloc;      // Map, then key bytes and entries
+    hash_map* map;          // Path to metadata_cache_entry*
+};
+
+file_metadata_cache* file_metadata_cache_init(uptr capacity) {
+    const uptr memory_size = 4096 + capacity * (64 + METADATA_CACHE_PATH_SIZE + sizeof(metadata_cache_entry));
+    void* memory = mem_map(memory_size);
+    file_metadata_cache* cache = memory;
+    cache->memory = memory;
+    cache->memory_size = memory_size;
+    sa_init(&cache->alloc, byteoffset(memory, sizeof(*cache)), byteoffset(memory, memory_size));
+    cache->map = hash_map_init(&cache->alloc, HASH_MAP_KEY_STRING, capacity);
+    return cache;
+}
+
+void file_metadata_cache_deinit(file_metadata_cache* cache) {
+    mem_unmap(cache->memory, cache->memory_size);
+}
+
+file_metadata file_metadata_cached(file_metadata_cache* cache, string path) {
+    uptr* value = hash_map_find_string(cache->map, path);
+    if (value) {
+        metadata_cache_entry* entry = (metadata_cache_entry*)*value;
+        if (!entry->valid) {
+            entry->metadata = metadata_cache_query(path);
+            entry->valid = 1;
+        }
+        return entry->metadata;
+    }
+
+    const file_metadata metadata = metadata_cache_query(path);
+
+    // Keys are not copied by the map, keep them with the entry
+    const uptr path_size = bytesize(path.begin, path.end);
+    const uptr entry_size = sizeof(metadata_cache_entry) + ((path_size + sizeof(void*) - 1) & ~(sizeof(void*) - 1));
+    if (bytesize(cache->alloc.cursor, cache->alloc.end) < entry_size) {
+        return metadata;
+    }
+    metadata_cache_entry* entry = sa_alloc(&cache->alloc, entry_size);
+    u8* key = (u8*)(entry + 1);
+    sa_copy(&cache->alloc, path.begin, key, path_size);
+
+    value = hash_map_insert_string(cache->map, (string){key, key + path_size}, 0);
+    if (!value) {
+        sa_free(&cache->alloc, entry);
+        return metadata;
+    }
+    entry->metadata = metadata;
+    entry->valid = 1;
+    *value = (uptr)entry;
+    return metadata;
+}
+
+void file_metadata_cache_invalidate(file_metadata_cache* cache, string path) {
+    uptr* value = hash_map_find_string(cache->map, path);
+    if (value) {
+        ((metadata_cache_entry*)*value)->valid = 0;
+    }
+}
+
 // Create directory recursively (like mkdir -p)
 void directory_create(stack_alloc* alloc, const u8* path_begin, const u8* path_end, dir_mode_t mode) {
 
@@ -220,121 +887,9 @@ void directory_create_for_file(stack_alloc *alloc, const u8 *path_begin, const u
 }
 
 
-// Node for our directory stack
-typedef struct {
-    void* previous;
-    // Path is allocated immediately after this struct
-    u8* path_start;
-    u8* path_end; // length = bytesize(path_start, path_end)
-} dir_node_t;
-
-// Remove directory recursively using a custom stack (no recursion)
+// Remove directory recursively, see directory_walk.h
 void directory_remove(stack_alloc* alloc, const u8* path_begin, const u8* path_end) {
-    void* begin = alloc->cursor;
-
-    // Allocate initial stack for one entry
-    dir_node_t* stack_begin = alloc->cursor;
-    dir_node_t* stack_cursor = stack_begin;
-
-    // Allocate root entry: structure + path
-    uptr root_size = bytesize(path_begin, path_end);
-    dir_node_t* root_node = sa_alloc(alloc, sizeof(*root_node));
-    root_node->previous = stack_begin - 1;
-    root_node->path_start = sa_alloc(alloc,root_size);
-    sa_copy(alloc, path_begin, root_node->path_start, root_size);
-    root_node->path_end   = alloc->cursor;
-
-    // Push root entry pointer onto stack
-    // stack_cursor  = alloc->cursor;
-
-    while (stack_cursor >= stack_begin) {
-        dir_node_t* dir_node = stack_cursor;
-
-        string dir_node_path_c;
-        dir_node_path_c.begin = sa_alloc(alloc, bytesize(dir_node->path_start, dir_node->path_end) + 1);
-        dir_node_path_c.end = alloc->cursor;
-        sa_copy(alloc, dir_node->path_start, (void*)dir_node_path_c.begin, bytesize(dir_node->path_start, dir_node->path_end));
-        *((u8*)dir_node_path_c.end - 1) = '\0';
-
-        DIR* dir = opendir(dir_node_path_c.begin);
-        if (!dir) {
-            unlink(dir_node_path_c.begin);
-            sa_free(alloc, (void*)dir_node_path_c.begin);
-            sa_free(alloc, dir_node); // free chunk
-            stack_cursor = stack_cursor->previous;
-            continue;
-        }
-        sa_free(alloc, (void*)dir_node_path_c.begin);
-        dir_node_path_c.begin = 0;
-        dir_node_path_c.end = 0;
-
-        struct dirent* entry;
-        int has_subdirs = 0;
-
-        while ((entry = readdir(dir)) != NULL) {
-            const string entry_name = {entry->d_name, byteoffset(entry->d_name, mem_cstrlen(entry->d_name))};
-            const uptr entry_len = bytesize(entry_name.begin, entry_name.end);
-            const string dot = STR(".");
-            const string dotdot = STR("..");
-            if (sa_equals(alloc, entry_name.begin, entry_name.end, dot.begin, dot.end)
-                || sa_equals(alloc, entry_name.begin, entry_name.end, dotdot.begin, dotdot.end)
-                || sa_equals(alloc, entry_name.begin, entry_name.end, 
-                        byteoffset(dir_node->path_end, -bytesize(entry_name.begin, entry_name.end) - 1), dir_node->path_end)) {
-                continue;
-            }
-            uptr dir_len   = bytesize(dir_node->path_start, dir_node->path_end);
-
-            // Allocate entry chunk: struct + path
-            dir_node_t* entry_node = sa_alloc(alloc, sizeof(*entry_node));
-            entry_node->previous = dir_node;
-            entry_node->path_start = alloc->cursor;
-
-            // Build path
-            void* cursor = sa_alloc(alloc, dir_len);
-            sa_copy(alloc, dir_node->path_start, cursor, dir_len);
-            *(u8*)sa_alloc(alloc, 1) = '/'; 
-            cursor = sa_alloc(alloc, entry_len);
-            sa_copy(alloc, entry->d_name, cursor, entry_len);
-            entry_node->path_end = alloc->cursor;
-
-            dir_node_path_c.begin = sa_alloc(alloc, bytesize(entry_node->path_start, entry_node->path_end) + 1);
-            dir_node_path_c.end = alloc->cursor;
-            sa_copy(alloc, entry_node->path_start, (void*)dir_node_path_c.begin, bytesize(entry_node->path_start, entry_node->path_end));
-            *((u8*)dir_node_path_c.end - 1) = '\0';
-            struct stat st;
-            if (stat(dir_node_path_c.begin, &st) == 0) {
-                if (S_ISDIR(st.st_mode)) {
-                    // Push subdirectory entry onto stack
-                    stack_cursor = entry_node;
-                    has_subdirs = 1;
-                    sa_free(alloc, (void*)dir_node_path_c.begin);
-                } else {
-                    unlink(dir_node_path_c.begin);
-                    sa_free(alloc, (void*)dir_node_path_c.begin);
-                    sa_free(alloc, entry_node);
-                }
-            } else {
-                sa_free(alloc, (void*)dir_node_path_c.begin);
-                sa_free(alloc, entry_node);
-            }
-        }
-
-        closedir(dir);
-
-        // Remove directory if no subdirectories remain
-        if (!has_subdirs) {
-            dir_node_path_c.begin = sa_alloc(alloc, bytesize(dir_node->path_start, dir_node->path_end) + 1);
-            dir_node_path_c.end = alloc->cursor;
-            rmdir(dir_node_path_c.begin);
-            sa_free(alloc, (void*)dir_node_path_c.begin);
-            sa_free(alloc, dir_node); // free chunk
-            stack_cursor = stack_cursor->previous;
-        }
-    }
-
-    sa_free(alloc, stack_begin); // free stack array
-
-    debug_assert(alloc->cursor == begin);
+    directory_walk_remove(alloc, path_begin, path_end, 1);
 }
 
 void directory_parent(const u8* path_begin, const u8* path_end, u8** out_begin, u8** out_end) {
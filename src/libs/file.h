@@ -3,6 +3,7 @@
 
 #include "primitive.h"
 #include "stack_alloc.h"
+#include "litteral.h"
 
 // File handle
 typedef i32 file_t;
@@ -24,17 +25,179 @@ file_t file_stdout(void);
 file_t file_stderr(void);
 
 // Read operations
+// Reads from offset 0 without moving the file position.
 uptr file_read_all(file_t file, void** buffer, stack_alloc* alloc);
 
+// Map the whole file content read-only, without copying it into a stack_alloc.
+// Returns {0, 0} for an empty file or on failure. The mapping stays valid after file_close.
+u8_slice file_map_readonly(file_t file);
+void file_unmap(u8_slice mapping);
+
+// Streaming reader over a file handle
+//
+// The file is read sequentially in fixed-size chunks into a ring of two buffers, so memory use
+// does not depend on the file size. Each chunk is chunk_size bytes except the last one, an empty
+// slice marks the end of the file. A returned chunk stays valid until the next call to
+// file_stream_next.
+//
+// FILE_STREAM_BACKGROUND reads the next chunk on a background thread while the current one is
+// processed. FILE_STREAM_SYNC reads on the calling thread. Both advise the kernel of sequential
+// access and request readahead of the next chunk.
+//
+// Example usage:
+//   file_stream* stream = file_stream_init(alloc, file, 1024 * 1024, FILE_STREAM_BACKGROUND);
+//   for (u8_slice chunk = file_stream_next(stream); chunk.begin != chunk.end; chunk = file_stream_next(stream)) {
+//       ...
+//   }
+//   file_stream_deinit(alloc, stream);
+typedef enum {
+    FILE_STREAM_SYNC,
+    FILE_STREAM_BACKGROUND
+} file_stream_mode;
+
+typedef struct file_stream file_stream;
+
+file_stream* file_stream_init(stack_alloc* alloc, file_t file, uptr chunk_size, file_stream_mode mode);
+u8_slice file_stream_next(file_stream* stream);
+// Stops the background reader if any. The stream must be the last allocation of alloc.
+void file_stream_deinit(stack_alloc* alloc, file_stream* stream);
+
 // Write operations
 uptr file_write(file_t file, const void* begin, const void* end);
 
+// Positional and vectored I/O
+//
+// The *_at functions transfer at 'offset' without using or moving the file position, so several
+// threads can share one file_t and access disjoint ranges without locking. The vector variants
+// transfer the slices in order with a single syscall in the common case. Partial transfers are
+// resumed, the functions return the number of bytes transferred, which is less than requested
+// only at end of file or on error.
+//
+// Example usage:
+//   const u8_slice slices[2] = {{header, header + header_size}, {payload, payload + payload_size}};
+//   file_write_vector(file, slices, slices + 2);
+uptr file_read_at(file_t file, void* begin, void* end, uptr offset);
+uptr file_write_at(file_t file, const void* begin, const void* end, uptr offset);
+uptr file_read_vector_at(file_t file, const u8_slice* slices_begin, const u8_slice* slices_end, uptr offset);
+uptr file_write_vector(file_t file, const u8_slice* slices_begin, const u8_slice* slices_end);
+uptr file_write_vector_at(file_t file, const u8_slice* slices_begin, const u8_slice* slices_end, uptr offset);
+
+// Copy the whole content of source over destination, which ends up with the size of source.
+// The data does not go through user memory: the file system is first asked to share the
+// source extents (reflink), then to copy them with copy_file_range. A read/write loop is used
+// when neither is supported. Returns the number of bytes copied.
+uptr file_copy(file_t destination, file_t source);
+
+// Atomic file replacement
+//
+// Content is written to a temporary file next to the destination, which is renamed over it on
+// commit: readers see either the previous or the new content, never a partial write. The new
+// file gets the permissions of the one it replaces, and a destination that is a symbolic link
+// stays one: the file it points to is replaced.
+//
+// Without a batch, the commit makes the new content durable right away (fsync of the file, then
+// rename, then fsync of the directory). With a batch, the renames are deferred to
+// file_sync_batch_commit, a group commit: one syncfs per file system makes the content of every
+// temporary file durable, then the files are renamed and their directories synced. The batch
+// commits by itself once FILE_SYNC_BATCH_MAX_RENAMES renames are pending, so an interrupted
+// process loses at most that many; until then the destinations keep their previous content.
+//
+// A destination is written at most once per batch, its temporary file is named after the process.
+//
+// A killed process leaves its temporary files behind, file_atomic_cleanup removes the ones of
+// processes that are not running anymore.
+//
+// Example usage:
+//   file_sync_batch batch;
+//   file_sync_batch_init(&batch);
+//   file_atomic* atomic = file_atomic_open(alloc, path.begin, path.end);
+//   file_write(file_atomic_file(atomic), begin, end);
+//   file_atomic_commit(alloc, atomic, &batch);
+//   file_sync_batch_commit(&batch);
+#define FILE_SYNC_BATCH_CAPACITY 8
+#define FILE_SYNC_BATCH_MAX_RENAMES 8
+// Bytes of address space reserved for the paths of the pending renames, a full batch is
+// committed early
+#define FILE_SYNC_BATCH_PATHS_SIZE (1024 * 1024)
+
+typedef struct {
+    file_t files[FILE_SYNC_BATCH_CAPACITY];     // One open file per file system to flush
+    u64 devices[FILE_SYNC_BATCH_CAPACITY];
+    u32 count;
+    u32 pending;                                // Renames waiting for the group commit
+    stack_alloc renames;                        // Temporary and destination paths, NUL terminated
+} file_sync_batch;
+
+void file_sync_batch_init(file_sync_batch* batch);
+// Flush, rename and release the batch, init it again to reuse it. Returns 0 if a rename failed.
+u8 file_sync_batch_commit(file_sync_batch* batch);
+
+typedef struct file_atomic file_atomic;
+
+// Returns 0 if the temporary file can not be created
+file_atomic* file_atomic_open(stack_alloc* alloc, const u8* path_begin, const u8* path_end);
+file_t file_atomic_file(file_atomic* atomic);
+// Replace the destination, batch is optional. Returns 1 on success. atomic must be the last allocation of alloc.
+u8 file_atomic_commit(stack_alloc* alloc, file_atomic* atomic, file_sync_batch* batch);
+// Drop the temporary file. atomic must be the last allocation of alloc.
+void file_atomic_abort(stack_alloc* alloc, file_atomic* atomic);
+// Remove the temporary files left under the directory by processes that exited.
+void file_atomic_cleanup(stack_alloc* alloc, const u8* directory_begin, const u8* directory_end);
+
+// Buffered writer over a file handle
+//
+// Writes are accumulated in a caller provided buffer and sent with a single syscall when the
+// buffer is full or on explicit flush. When incoming data does not fit, the buffered bytes and
+// the data are sent together with one writev instead of two writes.
+//
+// Example usage:
+//   u8 buffer[1024];
+//   file_writer writer;
+//   file_writer_init(&writer, file_stdout(), buffer, buffer + sizeof(buffer));
+//   file_writer_write(&writer, begin, end);
+//   file_writer_flush(&writer);
+typedef struct {
+    file_t file;
+    u8* begin;
+    u8* cursor;
+    u8* end;
+} file_writer;
+
+void file_writer_init(file_writer* writer, file_t file, void* buffer_begin, void* buffer_end);
+void file_writer_write(file_writer* writer, const void* begin, const void* end);
+void file_writer_flush(file_writer* writer);
+
 // Utility functions
 uptr file_size(file_t file);
 
 // Returns the modification time (milliseconds since epoch) for an open file handle.
 uptr file_modification_time(file_t file);
 
+// Metadata of a path, 'exists' is 0 when the path can not be queried
+typedef struct {
+    uptr modification_time; // milliseconds since epoch
+    uptr size;
+    u8 exists;
+} file_metadata;
+
+// Query the metadata of a path without opening it. Only the fields of file_metadata are
+// requested from statx, so the file system does not have to gather the others.
+file_metadata file_metadata_path(stack_alloc* alloc, string path);
+
+// Memoized path metadata
+//
+// Each path is queried once, later lookups are served from the cache until the path is
+// invalidated. This is how repeated queries are batched: a build checks each path once however
+// many targets depend on it. The cache maps its own memory, it holds up to 'capacity' paths and queries the
+// file system directly past that.
+typedef struct file_metadata_cache file_metadata_cache;
+
+file_metadata_cache* file_metadata_cache_init(uptr capacity);
+void file_metadata_cache_deinit(file_metadata_cache* cache);
+file_metadata file_metadata_cached(file_metadata_cache* cache, string path);
+// Forget the metadata of path, typically after it has been written.
+void file_metadata_cache_invalidate(file_metadata_cache* cache, string path);
+
 typedef enum {
     DIR_MODE_DEFAULT, // typical user-accessible
     DIR_MODE_PRIVATE, // only owner
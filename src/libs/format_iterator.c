@@ -1,45 +1,144 @@
 
 #include "format_iterator.h"
 #include "convert.h"
-#include "meta_iterator.h"
+#include "meta_plan.h"
 #include "stack_alloc.h"
 #include "assert.h"
 #include <stdarg.h>
 
-// Process a format specifier and get the result
-static char* process_format_specifier(char specifier, va_list args, stack_alloc* alloc) {
-    switch (specifier) {
-        case 'd': {
-            // Handle signed integer
-            i32 value = va_arg(args, i32);
-            return convert_i32_to_string(value, alloc);
+const char* format_spec_parse(const char* begin, const char* end, format_spec* spec) {
+    *spec = (format_spec){0};
+    const char* current = begin;
+    for (; current != end && (*current == '-' || *current == '0'); ++current) {
+        if (*current == '-') {
+            spec->left_align = 1;
+        } else {
+            spec->zero_pad = 1;
+        }
+    }
+    for (; current != end && *current >= '0' && *current <= '9'; ++current) {
+        spec->width = spec->width * 10 + (u32)(*current - '0');
+        if (spec->width > FORMAT_SPEC_MAX_WIDTH) {
+            spec->width = FORMAT_SPEC_MAX_WIDTH;
         }
-        case 'u': {
-            // Handle unsigned integer
-            u32 value = va_arg(args, u32);
-            return convert_u32_to_string(value, alloc);
+    }
+    if (current != end && *current == 'l') {
+        ++current;
+        spec->length = FORMAT_LENGTH_LONG;
+        if (current != end && *current == 'l') {
+            ++current;
+            spec->length = FORMAT_LENGTH_LONG_LONG;
+        }
+    } else if (current != end && *current == 'z') {
+        ++current;
+        spec->length = FORMAT_LENGTH_SIZE;
+    }
+    if (current == end) {
+        return current;
+    }
+    switch (*current) {
+        case 'd': case 'u': case 'x': case 'c': case 'p': case 's':
+        case 'f': case 'e': case 'g': case 'm':
+            spec->conversion = *current;
+            break;
+        default:
+            break;
+    }
+    return current + 1;
+}
+
+u32 format_spec_padding(const format_spec* spec, uptr length) {
+    return spec->width > length ? spec->width - (u32)length : 0;
+}
+
+static i64 read_signed(const format_spec* spec, va_list* args) {
+    switch (spec->length) {
+        case FORMAT_LENGTH_LONG: return va_arg(*args, long);
+        case FORMAT_LENGTH_LONG_LONG: return va_arg(*args, long long);
+        case FORMAT_LENGTH_SIZE: return va_arg(*args, iptr);
+        default: return va_arg(*args, i32);
+    }
+}
+
+static u64 read_unsigned(const format_spec* spec, va_list* args) {
+    switch (spec->length) {
+        case FORMAT_LENGTH_LONG: return va_arg(*args, unsigned long);
+        case FORMAT_LENGTH_LONG_LONG: return va_arg(*args, unsigned long long);
+        case FORMAT_LENGTH_SIZE: return va_arg(*args, uptr);
+        default: return va_arg(*args, u32);
+    }
+}
+
+u64 format_spec_read_arg(const format_spec* spec, va_list* args) {
+    switch (spec->conversion) {
+        case 'd': return (u64)read_signed(spec, args);
+        case 'u': case 'x': return read_unsigned(spec, args);
+        case 'f': case 'e': case 'g': {
+            const f64 value = va_arg(*args, f64);
+            u64 bits;
+            __builtin_memcpy(&bits, &value, sizeof(bits));
+            return bits;
         }
+        case 'c': return (u64)(u8)va_arg(*args, int);  // char is promoted to int
+        case 'p': return (uptr)va_arg(*args, void*);
+        default:
+            debug_assert(0);
+            return 0;
+    }
+}
 
+char* format_spec_write_value(const format_spec* spec, u64 value, char* out) {
+    char text[CONVERT_F64_MAX_CHARS];
+    char* end = text;
+    u8 numeric = 1;
+    f64 real;
+    __builtin_memcpy(&real, &value, sizeof(real));
+    switch (spec->conversion) {
+        case 'd': end = convert_i64_to_decimal((i64)value, text); break;
+        case 'u': end = convert_u64_to_decimal(value, text); break;
+        case 'x': end = convert_u64_to_hex(value, 1, text); break;
+        case 'f': end = convert_f64_to_chars(real, CONVERT_FLOAT_FIXED, text); break;
+        case 'e': end = convert_f64_to_chars(real, CONVERT_FLOAT_SCIENTIFIC, text); break;
+        case 'g': end = convert_f64_to_chars(real, CONVERT_FLOAT_GENERAL, text); break;
         case 'c': {
-            // Handle character
-            char c = (char)va_arg(args, int);  // char is promoted to int
-            char* result = sa_alloc(alloc, 1);
-            *result = c;
-            return result;
+            *end++ = (char)value;
+            numeric = 0;
+            break;
         }
         case 'p': {
-            // Handle pointer
-            void* ptr = va_arg(args, void*);
-            return convert_pointer_to_string(ptr, alloc);
-        }
-        default: {
-            // Handle unknown format specifier
-            char* result = (char*)sa_alloc(alloc, 2);
-            result[0] = '%';
-            result[1] = specifier;
-            return result;
+            *end++ = '0';
+            *end++ = 'x';
+            end = convert_u64_to_hex(value, value ? 8 : 1, end);
+            numeric = 0;
+            break;
         }
+        default:
+            debug_assert(0);
+            break;
     }
+
+    const uptr length = bytesize(text, end);
+    const u32 padding = format_spec_padding(spec, length);
+    if (spec->left_align) {
+        __builtin_memcpy(out, text, length);
+        __builtin_memset(out + length, ' ', padding);
+        return out + length + padding;
+    }
+    if (spec->zero_pad && numeric) {
+        // Zeros go between the sign and the digits
+        const uptr sign = text[0] == '-';
+        __builtin_memcpy(out, text, sign);
+        __builtin_memset(out + sign, '0', padding);
+        __builtin_memcpy(out + sign + padding, text + sign, length - sign);
+        return out + length + padding;
+    }
+    __builtin_memset(out, ' ', padding);
+    __builtin_memcpy(out + padding, text, length);
+    return out + padding + length;
+}
+
+char* format_spec_write_arg(const format_spec* spec, va_list* args, char* out) {
+    return format_spec_write_value(spec, format_spec_read_arg(spec, args), out);
 }
 
 // Shared text buffer and allocator used across chained format_iterators
@@ -54,28 +153,19 @@ struct format_iterator {
         const char* end;
     } format_segment;
     const char* format_current;
-    char specifier;
+    format_spec spec;
     
     u8 in_meta;
-    const meta* meta;
-    void* data_to_format;
-    print_meta_iterator* meta_iter;
-
-    u8 in_meta_array;
-    const meta* meta_array;
-    void* meta_array_data_to_format_begin;
-    void* meta_array_data_to_format_end;
-    void* meta_array_data_to_format_current;
-    format_iterator* meta_array_iterator;
+    meta_plan_cursor meta_cursor;
     
     stack_alloc* alloc;
-    uptr offset;
     va_list args;
 
     // State for handling large strings in chunks
     u8 in_string;
     const char* string_current;
     const char* string_end;
+    u32 string_padding_after;   // Spaces written once a left aligned string is done
 
     // Shared temporary buffer management for all stacked iterators in a chain
     format_shared_text* format_shared_text;
@@ -93,24 +183,14 @@ static format_iterator* format_iterator_init_extented(
     iter->format_current = format.begin;
     iter->format_segment.begin = format.begin;
     iter->format_segment.end = format.begin;
-    iter->specifier = 0;
+    iter->spec = (format_spec){0};
     iter->in_meta = 0;
-    iter->meta = 0;
-    iter->data_to_format = 0;
-    iter->meta_iter = 0;
-
-    iter->in_meta_array = 0;
-    iter->meta_array = 0;
-    iter->meta_array_data_to_format_begin = 0;
-    iter->meta_array_data_to_format_end = 0;
-    iter->meta_array_data_to_format_current = 0;
-    iter->meta_array_iterator = 0;
 
     iter->alloc = alloc;
-    iter->offset = 0;
     iter->in_string = 0;
     iter->string_current = 0;
     iter->string_end = 0;
+    iter->string_padding_after = 0;
 
     va_copy(iter->args, args);
 
@@ -119,16 +199,6 @@ static format_iterator* format_iterator_init_extented(
     return iter;
 }
 
-// [TASK] This doesn't work properly when adding array token litterals? "[", ",", "]"
-static format_iterator* format_iterator_init_wrapper_shared(format_iterator* parent, string format, ...) {
-    va_list args;
-    va_start(args, format);
-    format_iterator* iterator = format_iterator_init_extented(parent->alloc, format, args, 
-            parent->format_shared_text, /*owns_format_shared_text=*/ 0);
-    va_end(args);
-    return iterator;
-}
-
 format_iterator* format_iterator_init(stack_alloc* alloc, string format, va_list args) {
     
     format_shared_text* shared_text = sa_alloc(alloc, sizeof(*shared_text));
@@ -154,123 +224,25 @@ void format_iterator_deinit(stack_alloc* alloc, format_iterator* iterator) {
 format_iteration format_iterator_next(format_iterator* iter) {
     stack_alloc* text_format_alloc = &iter->format_shared_text->text_format_alloc;
     text_format_alloc->cursor = text_format_alloc->begin;
-    if (iter->in_meta_array) {
-        if (iter->meta_array_iterator != 0) {
-            format_iteration iteration = format_iterator_next(iter->meta_array_iterator);
-            if (iteration.type == FORMAT_ITERATION_END) {
-                format_iterator_deinit(iter->alloc, iter->meta_array_iterator);
-                iter->meta_array_iterator = 0;
-                return (format_iteration){FORMAT_ITERATION_CONTINUE, {0,0}};
-            }
-            return iteration;
-        } else {
-            const meta* element_meta = iter->meta_array->array_element_meta;
-            if (iter->meta_array_data_to_format_current == iter->meta_array_data_to_format_begin
-            && (iter->meta_array_data_to_format_current == iter->meta_array_data_to_format_end)) {
-                const string array_open_close = STR("[]");
-                sa_alloc_copy(text_format_alloc, array_open_close.begin, array_open_close.end);
-                iter->in_meta_array = 0;
-                return (format_iteration){FORMAT_ITERATION_LITERAL, {text_format_alloc->begin, text_format_alloc->cursor}};
-            } 
-            else if (iter->meta_array_data_to_format_current == iter->meta_array_data_to_format_begin) {
-                // First
-                const string array_open = STR("[");
-                sa_alloc_copy(text_format_alloc, array_open.begin, array_open.end);
-
-                iter->meta_array_iterator = format_iterator_init_wrapper_shared(iter, STRING("%m"), element_meta, iter->meta_array_data_to_format_current);
-                iter->meta_array_data_to_format_current = byteoffset(iter->meta_array_data_to_format_current, element_meta->type_size);
-                return (format_iteration){FORMAT_ITERATION_LITERAL, {text_format_alloc->begin, text_format_alloc->cursor}};
-            } else if(iter->meta_array_data_to_format_current == iter->meta_array_data_to_format_end) {
-                // Last
-                iter->in_meta_array = 0;
-                const string array_close = STR("]");
-                sa_alloc_copy(text_format_alloc, array_close.begin, array_close.end);
-                return (format_iteration){FORMAT_ITERATION_LITERAL, {text_format_alloc->begin, text_format_alloc->cursor}};
-            } else {
-                // Between
-                const string array_split = STR(", ");
-                sa_alloc_copy(text_format_alloc, array_split.begin, array_split.end);
-
-                iter->meta_array_iterator = format_iterator_init_wrapper_shared(iter, STRING("%m"), element_meta, iter->meta_array_data_to_format_current);
-                iter->meta_array_data_to_format_current = byteoffset(iter->meta_array_data_to_format_current, element_meta->type_size);
-                return (format_iteration){FORMAT_ITERATION_LITERAL, {text_format_alloc->begin, text_format_alloc->cursor}};
-            }
-        }
-    } else if (iter->in_meta) {
-        print_meta_iteration result = print_meta_iterator_next(iter->meta_iter);
-        if (!result.meta) {
+    if (iter->in_meta) {
+        if (meta_plan_cursor_done(&iter->meta_cursor)) {
             iter->in_meta = 0;
-            print_meta_iterator_deinit(iter->alloc, iter->meta_iter);
-            iter->meta_iter = 0;
-            // Continue with format
             return (format_iteration){FORMAT_ITERATION_CONTINUE, {0,0}};
         }
-        const meta* current = result.meta;
-        if (current->pt != PT_NONE) {
-            if (current->pt == PT_ARRAY) {
-                iter->in_meta_array = 1;
-                iter->meta_array = current;
-                iter->meta_array_data_to_format_begin = *(void**)(byteoffset(iter->data_to_format, iter->offset));
-                iter->meta_array_data_to_format_end = *(void**)(byteoffset(iter->data_to_format, iter->offset + sizeof(void*)));
-                iter->meta_array_data_to_format_current = iter->meta_array_data_to_format_begin;
-                return (format_iteration){FORMAT_ITERATION_CONTINUE, {0,0}};
-            }
-            // Primitive
-            void* data_offset = byteoffset(iter->data_to_format, iter->offset);
-            char* result;
-            switch (current->pt) {
-                case PT_I8: result = convert_i8_to_string(*(i8*)data_offset, text_format_alloc); break;
-                case PT_U8: result = convert_u8_to_string(*(u8*)data_offset, text_format_alloc); break;
-                case PT_I16: result = convert_i16_to_string(*(i16*)data_offset, text_format_alloc); break;
-                case PT_U16: result = convert_u16_to_string(*(u16*)data_offset, text_format_alloc); break;
-                case PT_I32: result = convert_i32_to_string(*(i32*)data_offset, text_format_alloc); break;
-                case PT_U32: result = convert_u32_to_string(*(u32*)data_offset, text_format_alloc); break;
-                case PT_I64: result = convert_i64_to_string(*(i64*)data_offset, text_format_alloc); break;
-                case PT_U64: result = convert_u64_to_string(*(u64*)data_offset, text_format_alloc); break;
-                case PT_IPTR: result = convert_iptr_to_string(*(iptr*)data_offset, text_format_alloc); break;
-                case PT_UPTR: result = convert_uptr_to_string(*(uptr*)data_offset, text_format_alloc); break;
-                default: {
-                    const string unknown = STR("<unknown primitive>");
-                    result = (char*)sa_alloc_copy(text_format_alloc, unknown.begin, unknown.end);
-                    break;
-                }
-                
-            }
-            return (format_iteration){FORMAT_ITERATION_LITERAL, {result, text_format_alloc->cursor}};
-        } else {
-            // Struct
-            void* start = text_format_alloc->cursor;
-            if (result.fields_current == result.meta->fields.begin) {
-                uptr name_len = bytesize(current->type_name.begin, current->type_name.end);
-                void* cursor = sa_alloc(text_format_alloc, name_len);
-                sa_copy(text_format_alloc, current->type_name.begin, cursor, name_len);
-                cursor = sa_alloc(text_format_alloc, 2);
-                sa_copy(text_format_alloc, " {", cursor, 2);
-                uptr field_len = bytesize(result.fields_current->field_name.begin, result.fields_current->field_name.end);
-                cursor = sa_alloc(text_format_alloc, field_len);
-                sa_copy(text_format_alloc, result.fields_current->field_name.begin, cursor, field_len);
-                cursor = sa_alloc(text_format_alloc, 2);
-                sa_copy(text_format_alloc, ": ", cursor, 2);
-                iter->offset = result.fields_current->offset;
-            } else if (result.fields_current == result.meta->fields.end) {
-                void* cursor = sa_alloc(text_format_alloc, 1);
-                sa_copy(text_format_alloc, "}", cursor, 1);
-                iter->offset -= (result.meta->fields.end - 1)->offset;
-            } else {
-                void* cursor = sa_alloc(text_format_alloc, 2);
-                sa_copy(text_format_alloc, ", ", cursor, 2);
-                uptr field_len = bytesize(result.fields_current->field_name.begin, result.fields_current->field_name.end);
-                cursor = sa_alloc(text_format_alloc, field_len);
-                sa_copy(text_format_alloc, result.fields_current->field_name.begin, cursor, field_len);;
-                cursor = sa_alloc(text_format_alloc, 2);
-                sa_copy(text_format_alloc, ": ", cursor, 2);
-                iter->offset = result.fields_current->offset;
-            }
-            return (format_iteration){FORMAT_ITERATION_LITERAL, {start, text_format_alloc->cursor}};
-        }
+        debug_assert(bytesize(text_format_alloc->cursor, text_format_alloc->end) >= META_PLAN_MIN_BUFFER);
+        char* result = text_format_alloc->cursor;
+        char* end = meta_plan_write(&iter->meta_cursor, result, text_format_alloc->end);
+        sa_alloc(text_format_alloc, bytesize(result, end));
+        return (format_iteration){FORMAT_ITERATION_LITERAL, {result, text_format_alloc->cursor}};
     } else if (iter->in_string) {
         if (iter->string_current == iter->string_end) {
             iter->in_string = 0;
+            if (iter->string_padding_after) {
+                char* result = sa_alloc(text_format_alloc, iter->string_padding_after);
+                __builtin_memset(result, ' ', iter->string_padding_after);
+                iter->string_padding_after = 0;
+                return (format_iteration){FORMAT_ITERATION_LITERAL, {result, text_format_alloc->cursor}};
+            }
             return (format_iteration){FORMAT_ITERATION_CONTINUE, {0,0}};
         }
         uptr remaining = (uptr)(iter->string_end - iter->string_current);
@@ -286,41 +258,42 @@ format_iteration format_iterator_next(format_iterator* iter) {
         }
         if (*iter->format_current == '%') {
             iter->format_segment.begin = iter->format_current;
-            iter->format_current++;
-            if (iter->format_current == iter->format.end) {
-                iter->format_segment.end = iter->format_current;
-                iter->format_current++;
+            iter->format_current = format_spec_parse(iter->format_current + 1, iter->format.end, &iter->spec);
+            iter->format_segment.end = iter->format_current;
+            const format_spec* spec = &iter->spec;
+            if (spec->conversion == 0) {
+                // Unknown or incomplete specifier, printed as is
                 return (format_iteration){FORMAT_ITERATION_LITERAL, {iter->format_segment.begin, iter->format_segment.end}};
-            }
-            iter->specifier = *iter->format_current;
-            iter->format_segment.end = iter->format_current + 1;
-            iter->format_current++;
-            if (iter->specifier == 'm') {
-                iter->meta = va_arg(iter->args, const meta*);
-                iter->data_to_format = va_arg(iter->args, void*);
+            } else if (spec->conversion == 'm') {
+                const meta* m = va_arg(iter->args, const meta*);
+                const void* data = va_arg(iter->args, const void*);
+                meta_plan_cursor_init(&iter->meta_cursor, meta_plan_get(m), data);
                 iter->in_meta = 1;
-                iter->offset = 0;
-                iter->meta_iter = print_meta_iterator_init(iter->alloc, iter->meta);
                 return (format_iteration){FORMAT_ITERATION_CONTINUE, {0,0}};
-            } else if (iter->specifier == 's') {
+            } else if (spec->conversion == 's') {
                 // Handle string specially for chunking
-                const string str = va_arg(iter->args, const string);
-                if (str.begin && str.end) {
-                    iter->in_string = 1;
-                    iter->string_current = str.begin;
-                    iter->string_end = str.end;
-                    return (format_iteration){FORMAT_ITERATION_CONTINUE, {0,0}};
-                } else {
-                    // Handle null string
-                    const string null_str = STR("(null)");
-                    const uptr null_str_size = bytesize(null_str.begin, null_str.end);
-                    char* result = sa_alloc(text_format_alloc, null_str_size);
-                    sa_copy(text_format_alloc, null_str.begin, result, null_str_size);
+                string str = va_arg(iter->args, const string);
+                if (!str.begin || !str.end) {
+                    str = STRING("(null)");
+                }
+                iter->in_string = 1;
+                iter->string_current = str.begin;
+                iter->string_end = str.end;
+                const u32 padding = format_spec_padding(spec, bytesize(str.begin, str.end));
+                if (spec->left_align) {
+                    iter->string_padding_after = padding;
+                } else if (padding) {
+                    char* result = sa_alloc(text_format_alloc, padding);
+                    __builtin_memset(result, ' ', padding);
                     return (format_iteration){FORMAT_ITERATION_LITERAL, {result, text_format_alloc->cursor}};
                 }
+                return (format_iteration){FORMAT_ITERATION_CONTINUE, {0,0}};
             } else {
                 // Process other specifiers
-                char* result = process_format_specifier(iter->specifier, iter->args, text_format_alloc);
+                debug_assert(bytesize(text_format_alloc->cursor, text_format_alloc->end) >= FORMAT_SPEC_MAX_CHARS);
+                char* result = text_format_alloc->cursor;
+                char* end = format_spec_write_arg(spec, &iter->args, result);
+                sa_alloc(text_format_alloc, bytesize(result, end));
                 return (format_iteration){FORMAT_ITERATION_LITERAL, {result, text_format_alloc->cursor}};
             }
         } else {
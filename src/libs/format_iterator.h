@@ -3,8 +3,51 @@
 
 #include "stack_alloc.h"
 #include "litteral.h"
+#include "convert.h"
 #include <stdarg.h>
 
+// Format specifiers
+//
+//   %[flags][width][length]conversion
+//
+// flags: '-' aligns left, '0' pads numbers with zeros after the sign.
+// width: minimum number of characters, padded with spaces on the left by default. Capped at
+//        FORMAT_SPEC_MAX_WIDTH.
+// length: 'l' (long), 'll' (long long) or 'z' (size) for d, u and x, which read a 32-bit value
+//         otherwise.
+// conversion: d (signed), u (unsigned), x (lowercase hex), c (char), p (pointer), s (string),
+//             f, e, g (f64, shortest round-trip digits), m (meta and data pointer, width ignored).
+// An unknown conversion is printed as is and reads no argument.
+#define FORMAT_SPEC_MAX_WIDTH 64
+// Longest output of format_spec_write_arg
+#define FORMAT_SPEC_MAX_CHARS (CONVERT_F64_MAX_CHARS + FORMAT_SPEC_MAX_WIDTH)
+
+typedef enum {
+    FORMAT_LENGTH_DEFAULT,
+    FORMAT_LENGTH_LONG,
+    FORMAT_LENGTH_LONG_LONG,
+    FORMAT_LENGTH_SIZE
+} format_length;
+
+typedef struct {
+    char conversion;            // 0 when the specifier is unknown or incomplete
+    u8 length;                  // format_length
+    u8 left_align;
+    u8 zero_pad;
+    u32 width;
+} format_spec;
+
+// Parse the specifier following a '%' in [begin, end). Returns the end of the specifier.
+const char* format_spec_parse(const char* begin, const char* end, format_spec* spec);
+// Number of padding characters for a text of 'length' characters.
+u32 format_spec_padding(const format_spec* spec, uptr length);
+// Read the argument of a specifier other than s and m, and write it padded to out, which holds
+// FORMAT_SPEC_MAX_CHARS characters. Returns the end of the text.
+char* format_spec_write_arg(const format_spec* spec, va_list* args, char* out);
+// The same in two steps: the argument as 64 bits (f64 values as their bits), then its text.
+u64 format_spec_read_arg(const format_spec* spec, va_list* args);
+char* format_spec_write_value(const format_spec* spec, u64 value, char* out);
+
 typedef struct format_iterator format_iterator;
 format_iterator* format_iterator_init(stack_alloc* alloc, string format, va_list args);
 void format_iterator_deinit(stack_alloc* alloc, format_iterator* iterator);
@@ -0,0 +1,275 @@
+#include "hash_map.h"
+#include "assert.h"
+
+#define GROUP_SIZE 16
+#define CONTROL_EMPTY ((u8)0x80)
+#define CONTROL_DELETED ((u8)0xFE)
+
+#if defined(__SSE2__)
+// GCC vector type, used instead of <emmintrin.h> which pulls the libc headers
+typedef char group_vector __attribute__((vector_size(GROUP_SIZE)));
+#endif
+
+typedef struct {
+    union {
+        string s;
+        u64 u;
+    } key;
+    uptr value;
+} entry;
+
+struct hash_map {
+    void* allocation;       // Start of the block in the stack_alloc (before alignment)
+    u8* control;            // One control byte per slot, grouped by GROUP_SIZE
+    entry* entries;         // One entry per slot
+    uptr group_mask;        // Number of groups - 1 (power of two)
+    uptr count;
+    uptr growth_left;       // Empty slots that can still be consumed before the map is full
+    uptr growth_max;
+    hash_map_key_type key_type;
+};
+
+// Key passed to the internal lookup, only the member matching the map key type is used
+typedef struct {
+    string s;
+    u64 u;
+} lookup_key;
+
+// Bitmask of the slots of the group whose control byte equals value
+static u32 group_match(const u8* control, u8 value) {
+#if defined(__SSE2__)
+    group_vector group;
+    __builtin_memcpy(&group, control, sizeof(group));
+    const group_vector values = (group_vector){0} + (char)value;
+    return (u32)__builtin_ia32_pmovmskb128(group == values);
+#else
+    u32 mask = 0;
+    for (u32 i = 0; i < GROUP_SIZE; ++i) {
+        if (control[i] == value) {mask |= 1u << i;}
+    }
+    return mask;
+#endif
+}
+
+// Bitmask of the slots of the group that are empty or deleted (high bit set)
+static u32 group_match_free(const u8* control) {
+#if defined(__SSE2__)
+    group_vector group;
+    __builtin_memcpy(&group, control, sizeof(group));
+    return (u32)__builtin_ia32_pmovmskb128(group);
+#else
+    u32 mask = 0;
+    for (u32 i = 0; i < GROUP_SIZE; ++i) {
+        if (control[i] & 0x80) {mask |= 1u << i;}
+    }
+    return mask;
+#endif
+}
+
+static u64 key_hash(hash_map* map, lookup_key key) {
+    if (map->key_type == HASH_MAP_KEY_STRING) {
+        return hash_bytes(key.s.begin, key.s.end);
+    }
+    return hash_u64(key.u);
+}
+
+static u8 key_equals(hash_map* map, const entry* e, lookup_key key) {
+    if (map->key_type == HASH_MAP_KEY_U64) {
+        return e->key.u == key.u;
+    }
+    const uptr size = bytesize(key.s.begin, key.s.end);
+    return bytesize(e->key.s.begin, e->key.s.end) == size
+        && __builtin_memcmp(e->key.s.begin, key.s.begin, size) == 0;
+}
+
+// Slot index holding key, (uptr)-1 if absent
+static uptr find_index(hash_map* map, u64 hash, lookup_key key) {
+    const u8 h2 = (u8)(hash & 0x7F);
+    uptr group = (uptr)(hash >> 7) & map->group_mask;
+    for (uptr stride = 1;; ++stride) {
+        const u8* control = map->control + group * GROUP_SIZE;
+        u32 match = group_match(control, h2);
+        while (match) {
+            const uptr slot = group * GROUP_SIZE + (uptr)__builtin_ctz(match);
+            if (key_equals(map, &map->entries[slot], key)) {
+                return slot;
+            }
+            match &= match - 1;
+        }
+        // A probe sequence never continues past a group that still has an empty slot
+        if (group_match(control, CONTROL_EMPTY) || stride > map->group_mask) {
+            return (uptr)-1;
+        }
+        // Triangular probing visits every group when the group count is a power of two
+        group = (group + stride) & map->group_mask;
+    }
+}
+
+static uptr* insert(hash_map* map, lookup_key key, u8* inserted) {
+    if (inserted) {*inserted = 0;}
+
+    const u64 hash = key_hash(map, key);
+    const uptr existing = find_index(map, hash, key);
+    if (existing != (uptr)-1) {
+        return &map->entries[existing].value;
+    }
+
+    uptr group = (uptr)(hash >> 7) & map->group_mask;
+    uptr slot;
+    for (uptr stride = 1;; ++stride) {
+        const u32 free = group_match_free(map->control + group * GROUP_SIZE);
+        if (free) {
+            slot = group * GROUP_SIZE + (uptr)__builtin_ctz(free);
+            break;
+        }
+        if (stride > map->group_mask) {
+            return 0;
+        }
+        group = (group + stride) & map->group_mask;
+    }
+
+    if (map->control[slot] == CONTROL_EMPTY) {
+        if (map->growth_left == 0) {
+            return 0;
+        }
+        map->growth_left -= 1;
+    }
+
+    map->control[slot] = (u8)(hash & 0x7F);
+    entry* e = &map->entries[slot];
+    if (map->key_type == HASH_MAP_KEY_STRING) {
+        e->key.s = key.s;
+    } else {
+        e->key.u = key.u;
+    }
+    e->value = 0;
+    map->count += 1;
+
+    if (inserted) {*inserted = 1;}
+    return &e->value;
+}
+
+static u8 remove_key(hash_map* map, lookup_key key) {
+    const uptr slot = find_index(map, key_hash(map, key), key);
+    if (slot == (uptr)-1) {
+        return 0;
+    }
+
+    // If the group still has an empty slot, no probe sequence went past it: the slot can be
+    // made empty again instead of leaving a tombstone.
+    const u8* group_control = map->control + (slot / GROUP_SIZE) * GROUP_SIZE;
+    if (group_match(group_control, CONTROL_EMPTY)) {
+        map->control[slot] = CONTROL_EMPTY;
+        map->growth_left += 1;
+    } else {
+        map->control[slot] = CONTROL_DELETED;
+    }
+    map->count -= 1;
+    return 1;
+}
+
+hash_map* hash_map_init(stack_alloc* alloc, hash_map_key_type key_type, uptr capacity) {
+    void* begin = alloc->cursor;
+
+    // Keep the load factor under 7/8
+    uptr slots = GROUP_SIZE;
+    while (slots - slots / 8 < capacity) {
+        slots *= 2;
+    }
+
+    // Align the control bytes so that a group never straddles a cache line
+    sa_alloc(alloc, (uptr)(-(uptr)begin & (GROUP_SIZE - 1)));
+    u8* control = sa_alloc(alloc, slots);
+    entry* entries = sa_alloc(alloc, slots * sizeof(entry));
+
+    hash_map* map = sa_alloc(alloc, sizeof(*map));
+    map->allocation = begin;
+    map->control = control;
+    map->entries = entries;
+    map->group_mask = slots / GROUP_SIZE - 1;
+    map->growth_max = slots - slots / 8;
+    map->key_type = key_type;
+    hash_map_clear(map);
+    return map;
+}
+
+void hash_map_deinit(stack_alloc* alloc, hash_map* map) {
+    debug_assert(byteoffset(map, sizeof(*map)) == alloc->cursor);
+    sa_free(alloc, map->allocation);
+}
+
+void hash_map_clear(hash_map* map) {
+    __builtin_memset(map->control, CONTROL_EMPTY, (map->group_mask + 1) * GROUP_SIZE);
+    map->count = 0;
+    map->growth_left = map->growth_max;
+}
+
+uptr hash_map_count(hash_map* map) {
+    return map->count;
+}
+
+uptr* hash_map_find_string(hash_map* map, string key) {
+    debug_assert(map->key_type == HASH_MAP_KEY_STRING);
+    const lookup_key k = {.s = key};
+    const uptr slot = find_index(map, hash_bytes(key.begin, key.end), k);
+    return slot == (uptr)-1 ? 0 : &map->entries[slot].value;
+}
+
+uptr* hash_map_find_u64(hash_map* map, u64 key) {
+    debug_assert(map->key_type == HASH_MAP_KEY_U64);
+    const lookup_key k = {.u = key};
+    const uptr slot = find_index(map, hash_u64(key), k);
+    return slot == (uptr)-1 ? 0 : &map->entries[slot].value;
+}
+
+uptr* hash_map_insert_string(hash_map* map, string key, u8* inserted) {
+    debug_assert(map->key_type == HASH_MAP_KEY_STRING);
+    return insert(map, (lookup_key){.s = key}, inserted);
+}
+
+uptr* hash_map_insert_u64(hash_map* map, u64 key, u8* inserted) {
+    debug_assert(map->key_type == HASH_MAP_KEY_U64);
+    return insert(map, (lookup_key){.u = key}, inserted);
+}
+
+u8 hash_map_remove_string(hash_map* map, string key) {
+    debug_assert(map->key_type == HASH_MAP_KEY_STRING);
+    return remove_key(map, (lookup_key){.s = key});
+}
+
+u8 hash_map_remove_u64(hash_map* map, u64 key) {
+    debug_assert(map->key_type == HASH_MAP_KEY_U64);
+    return remove_key(map, (lookup_key){.u = key});
+}
+
+u64 hash_bytes(const void* begin, const void* end) {
+    const u64 multiplier = 0x9E3779B97F4A7C15ULL;
+    uptr size = bytesize(begin, end);
+    const u8* cursor = begin;
+
+    u64 hash = (u64)size * multiplier;
+    while (size >= sizeof(u64)) {
+        u64 word;
+        __builtin_memcpy(&word, cursor, sizeof(word));
+        hash = (hash ^ word) * multiplier;
+        hash ^= hash >> 32;
+        cursor += sizeof(u64);
+        size -= sizeof(u64);
+    }
+    if (size > 0) {
+        u64 word = 0;
+        __builtin_memcpy(&word, cursor, size);
+        hash = (hash ^ word) * multiplier;
+    }
+    return hash_u64(hash);
+}
+
+// Murmur3 finalizer
+u64 hash_u64(u64 value) {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return value;
+}
@@ -0,0 +1,61 @@
+#ifndef HASH_MAP_H
+#define HASH_MAP_H
+
+#include "primitive.h"
+#include "litteral.h"
+#include "stack_alloc.h"
+
+// Open-addressing hash map allocated from a stack_alloc
+//
+// Slots are organized in groups of 16 control bytes followed by the entries. A control byte is
+// either empty, deleted or holds 7 bits of the key hash, so a whole group is probed with a single
+// SSE2 comparison (scalar fallback when SSE2 is not available) before any key is touched.
+//
+// The capacity is fixed at init because a stack_alloc block cannot grow in place: size the map
+// for the maximum number of entries that will be inserted. Insertion returns 0 once it is full.
+//
+// Keys are either strings or u64, chosen at init. String keys are not copied, the key bytes must
+// outlive the map. Values are uptr (large enough to hold a pointer).
+//
+// Example usage:
+//   hash_map* map = hash_map_init(alloc, HASH_MAP_KEY_STRING, 128);
+//   *hash_map_insert_string(map, STRING("name"), 0) = 42;
+//   uptr* value = hash_map_find_string(map, STRING("name"));
+//   hash_map_deinit(alloc, map);
+
+typedef enum {
+    HASH_MAP_KEY_STRING,
+    HASH_MAP_KEY_U64
+} hash_map_key_type;
+
+typedef struct hash_map hash_map;
+
+// Allocate a map able to hold at least 'capacity' entries.
+hash_map* hash_map_init(stack_alloc* alloc, hash_map_key_type key_type, uptr capacity);
+
+// Free the map. It must be the last allocation of alloc.
+void hash_map_deinit(stack_alloc* alloc, hash_map* map);
+
+// Remove every entry, keeping the allocated slots.
+void hash_map_clear(hash_map* map);
+
+uptr hash_map_count(hash_map* map);
+
+// Returns a pointer to the value associated with key, 0 if not present.
+uptr* hash_map_find_string(hash_map* map, string key);
+uptr* hash_map_find_u64(hash_map* map, u64 key);
+
+// Returns a pointer to the value associated with key, inserting a zero value if not present.
+// 'inserted' (optional) is set to 1 when the entry is new. Returns 0 when the map is full.
+uptr* hash_map_insert_string(hash_map* map, string key, u8* inserted);
+uptr* hash_map_insert_u64(hash_map* map, u64 key, u8* inserted);
+
+// Returns 1 if the key was present and has been removed.
+u8 hash_map_remove_string(hash_map* map, string key);
+u8 hash_map_remove_u64(hash_map* map, u64 key);
+
+// Hash functions used by the map.
+u64 hash_bytes(const void* begin, const void* end);
+u64 hash_u64(u64 value);
+
+#endif /* HASH_MAP_H */
@@ -0,0 +1,461 @@
+#include "json.h"
+#include "convert.h"
+
+#if defined(__SSE2__)
+// GCC vector type, used instead of <emmintrin.h> which pulls the libc headers
+typedef char byte_vector __attribute__((vector_size(16)));
+#endif
+
+typedef enum {
+    STATE_VALUE,
+    STATE_VALUE_OR_ARRAY_END,
+    STATE_KEY,
+    STATE_KEY_OR_OBJECT_END,
+    STATE_AFTER_VALUE,
+    STATE_ERROR
+} tokenizer_state;
+
+// First byte of [p, end) that ends a run of plain string content: a quote, a backslash or a
+// control character. Returns end if there is none.
+static const u8* find_string_special(const u8* p, const u8* end) {
+#if defined(__SSE2__)
+    const byte_vector quote = (byte_vector){0} + '"';
+    const byte_vector backslash = (byte_vector){0} + '\\';
+    const byte_vector space = (byte_vector){0} + ' ';
+    const byte_vector zero = {0};
+    while (bytesize(p, end) >= sizeof(byte_vector)) {
+        byte_vector bytes;
+        __builtin_memcpy(&bytes, p, sizeof(bytes));
+        // Bytes from 0x80 compare as negative, only [0, 0x20) are control characters
+        const byte_vector special = (bytes == quote) | (bytes == backslash) | ((bytes < space) & (bytes >= zero));
+        const u32 mask = (u32)__builtin_ia32_pmovmskb128(special);
+        if (mask) {
+            return p + __builtin_ctz(mask);
+        }
+        p += sizeof(byte_vector);
+    }
+#endif
+    while (p < end && *p != '"' && *p != '\\' && *p >= 0x20) {
+        ++p;
+    }
+    return p;
+}
+
+static const u8* skip_whitespace(const u8* p, const u8* end) {
+    while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) {
+        ++p;
+    }
+    return p;
+}
+
+static u8 is_digit(u8 c) {
+    return c >= '0' && c <= '9';
+}
+
+// Value of 4 hexadecimal digits, or a value above 0xFFFF if one is not a digit
+static u32 read_hex4(const u8* p) {
+    u32 value = 0;
+    for (u32 i = 0; i < 4; ++i) {
+        const u8 c = p[i];
+        u32 digit;
+        if (is_digit(c)) {digit = (u32)(c - '0');}
+        else if (c >= 'a' && c <= 'f') {digit = (u32)(c - 'a' + 10);}
+        else if (c >= 'A' && c <= 'F') {digit = (u32)(c - 'A' + 10);}
+        else {return 0x10000;}
+        value = (value << 4) | digit;
+    }
+    return value;
+}
+
+// p is after the opening quote. Returns the closing quote, 0 if the string is invalid.
+static const u8* scan_string(const u8* p, const u8* end) {
+    for (;;) {
+        p = find_string_special(p, end);
+        if (p == end || *p < 0x20) {
+            return 0;
+        }
+        if (*p == '"') {
+            return p;
+        }
+        if (bytesize(p, end) < 2) {
+            return 0;
+        }
+        switch (p[1]) {
+            case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+                p += 2;
+                break;
+            case 'u':
+                if (bytesize(p, end) < 6 || read_hex4(p + 2) > 0xFFFF) {
+                    return 0;
+                }
+                p += 6;
+                break;
+            default:
+                return 0;
+        }
+    }
+}
+
+// Returns the end of the number starting at p, 0 if it is invalid.
+static const u8* scan_number(const u8* p, const u8* end) {
+    if (p < end && *p == '-') {++p;}
+    if (p == end || !is_digit(*p)) {
+        return 0;
+    }
+    if (*p == '0') {
+        ++p;
+    } else {
+        while (p < end && is_digit(*p)) {++p;}
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        if (p == end || !is_digit(*p)) {return 0;}
+        while (p < end && is_digit(*p)) {++p;}
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        if (p < end && (*p == '+' || *p == '-')) {++p;}
+        if (p == end || !is_digit(*p)) {return 0;}
+        while (p < end && is_digit(*p)) {++p;}
+    }
+    return p;
+}
+
+void json_tokenizer_init(json_tokenizer* t, const void* begin, const void* end) {
+    t->cursor = begin;
+    t->end = end;
+    t->object_levels = 0;
+    t->depth = 0;
+    t->state = STATE_VALUE;
+}
+
+static json_token fail(json_tokenizer* t, const u8* p) {
+    t->state = STATE_ERROR;
+    t->cursor = p;
+    return (json_token){JSON_TOKEN_ERROR, {p, p}};
+}
+
+static json_token close_container(json_tokenizer* t, const u8* p, u8 is_object) {
+    t->depth -= 1;
+    t->state = STATE_AFTER_VALUE;
+    t->cursor = p + 1;
+    return (json_token){is_object ? JSON_TOKEN_OBJECT_END : JSON_TOKEN_ARRAY_END, {p, p + 1}};
+}
+
+static json_token read_literal(json_tokenizer* t, const u8* p, string literal, json_token_type type) {
+    const uptr size = bytesize(literal.begin, literal.end);
+    if (bytesize(p, t->end) < size || __builtin_memcmp(p, literal.begin, size) != 0) {
+        return fail(t, p);
+    }
+    t->state = STATE_AFTER_VALUE;
+    t->cursor = p + size;
+    return (json_token){type, {p, t->cursor}};
+}
+
+static json_token read_value(json_tokenizer* t, const u8* p) {
+    switch (*p) {
+        case '{':
+        case '[': {
+            if (t->depth == JSON_MAX_DEPTH) {
+                return fail(t, p);
+            }
+            const u8 is_object = *p == '{';
+            const u64 level = 1ull << t->depth;
+            t->object_levels = is_object ? (t->object_levels | level) : (t->object_levels & ~level);
+            t->depth += 1;
+            t->state = is_object ? STATE_KEY_OR_OBJECT_END : STATE_VALUE_OR_ARRAY_END;
+            t->cursor = p + 1;
+            return (json_token){is_object ? JSON_TOKEN_OBJECT_BEGIN : JSON_TOKEN_ARRAY_BEGIN, {p, p + 1}};
+        }
+        case '"': {
+            const u8* close = scan_string(p + 1, t->end);
+            if (!close) {
+                return fail(t, p);
+            }
+            t->state = STATE_AFTER_VALUE;
+            t->cursor = close + 1;
+            return (json_token){JSON_TOKEN_STRING, {p + 1, close}};
+        }
+        case 't': return read_literal(t, p, STRING("true"), JSON_TOKEN_TRUE);
+        case 'f': return read_literal(t, p, STRING("false"), JSON_TOKEN_FALSE);
+        case 'n': return read_literal(t, p, STRING("null"), JSON_TOKEN_NULL);
+        default: {
+            const u8* number_end = scan_number(p, t->end);
+            if (!number_end) {
+                return fail(t, p);
+            }
+            t->state = STATE_AFTER_VALUE;
+            t->cursor = number_end;
+            return (json_token){JSON_TOKEN_NUMBER, {p, number_end}};
+        }
+    }
+}
+
+json_token json_next(json_tokenizer* t) {
+    const u8* p = skip_whitespace(t->cursor, t->end);
+    if (t->state == STATE_ERROR) {
+        return fail(t, t->cursor);
+    }
+
+    if (t->state == STATE_AFTER_VALUE) {
+        if (t->depth == 0) {
+            if (p != t->end) {
+                return fail(t, p);
+            }
+            t->cursor = p;
+            return (json_token){JSON_TOKEN_END, {p, p}};
+        }
+        const u8 in_object = (t->object_levels >> (t->depth - 1)) & 1;
+        if (p < t->end && *p == (in_object ? '}' : ']')) {
+            return close_container(t, p, in_object);
+        }
+        if (p == t->end || *p != ',') {
+            return fail(t, p);
+        }
+        p = skip_whitespace(p + 1, t->end);
+        t->state = in_object ? STATE_KEY : STATE_VALUE;
+    }
+
+    if (p == t->end) {
+        return fail(t, p);
+    }
+    switch (t->state) {
+        case STATE_KEY_OR_OBJECT_END:
+            if (*p == '}') {
+                return close_container(t, p, 1);
+            }
+            /* fallthrough */
+        case STATE_KEY: {
+            const u8* close = *p == '"' ? scan_string(p + 1, t->end) : 0;
+            if (!close) {
+                return fail(t, p);
+            }
+            const u8* colon = skip_whitespace(close + 1, t->end);
+            if (colon == t->end || *colon != ':') {
+                return fail(t, colon);
+            }
+            t->state = STATE_VALUE;
+            t->cursor = colon + 1;
+            return (json_token){JSON_TOKEN_KEY, {p + 1, close}};
+        }
+        case STATE_VALUE_OR_ARRAY_END:
+            if (*p == ']') {
+                return close_container(t, p, 0);
+            }
+            /* fallthrough */
+        default:
+            return read_value(t, p);
+    }
+}
+
+json_token json_skip(json_tokenizer* t, json_token token) {
+    if (token.type != JSON_TOKEN_OBJECT_BEGIN && token.type != JSON_TOKEN_ARRAY_BEGIN) {
+        return token;
+    }
+    const u32 depth = t->depth - 1;
+    for (;;) {
+        token = json_next(t);
+        if (token.type == JSON_TOKEN_ERROR) {
+            return token;
+        }
+        if ((token.type == JSON_TOKEN_OBJECT_END || token.type == JSON_TOKEN_ARRAY_END) && t->depth == depth) {
+            return token;
+        }
+    }
+}
+
+json_token json_object_find(json_tokenizer* t, string key) {
+    const uptr key_size = bytesize(key.begin, key.end);
+    for (;;) {
+        const json_token name = json_next(t);
+        if (name.type != JSON_TOKEN_KEY) {
+            return name;
+        }
+        json_token value = json_next(t);
+        if (bytesize(name.text.begin, name.text.end) == key_size && __builtin_memcmp(name.text.begin, key.begin, key_size) == 0) {
+            return value;
+        }
+        value = json_skip(t, value);
+        if (value.type == JSON_TOKEN_ERROR) {
+            return value;
+        }
+    }
+}
+
+static void write_byte(stack_alloc* alloc, u8 c) {
+    *(u8*)sa_alloc(alloc, 1) = c;
+}
+
+static void write_utf8(stack_alloc* alloc, u32 code_point) {
+    if (code_point < 0x80) {
+        write_byte(alloc, (u8)code_point);
+    } else if (code_point < 0x800) {
+        write_byte(alloc, (u8)(0xC0 | (code_point >> 6)));
+        write_byte(alloc, (u8)(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        write_byte(alloc, (u8)(0xE0 | (code_point >> 12)));
+        write_byte(alloc, (u8)(0x80 | ((code_point >> 6) & 0x3F)));
+        write_byte(alloc, (u8)(0x80 | (code_point & 0x3F)));
+    } else {
+        write_byte(alloc, (u8)(0xF0 | (code_point >> 18)));
+        write_byte(alloc, (u8)(0x80 | ((code_point >> 12) & 0x3F)));
+        write_byte(alloc, (u8)(0x80 | ((code_point >> 6) & 0x3F)));
+        write_byte(alloc, (u8)(0x80 | (code_point & 0x3F)));
+    }
+}
+
+u8* json_unescape(stack_alloc* alloc, string text) {
+    u8* begin = alloc->cursor;
+    const u8* p = text.begin;
+    const u8* end = text.end;
+    while (p < end) {
+        const u8* run = p;
+        while (p < end && *p != '\\') {++p;}
+        sa_alloc_copy(alloc, run, p);
+        if (bytesize(p, end) < 2) {
+            break;
+        }
+
+        const u8 escaped = p[1];
+        p += 2;
+        switch (escaped) {
+            case 'b': write_byte(alloc, '\b'); break;
+            case 'f': write_byte(alloc, '\f'); break;
+            case 'n': write_byte(alloc, '\n'); break;
+            case 'r': write_byte(alloc, '\r'); break;
+            case 't': write_byte(alloc, '\t'); break;
+            case 'u': {
+                u32 code_point = bytesize(p, end) >= 4 ? read_hex4(p) : 0x10000;
+                if (code_point > 0xFFFF) {
+                    // Not produced by the tokenizer, kept as is
+                    sa_alloc_copy(alloc, p - 2, p);
+                    break;
+                }
+                p += 4;
+                if (code_point >= 0xD800 && code_point < 0xDC00) {
+                    const u32 low = bytesize(p, end) >= 6 && p[0] == '\\' && p[1] == 'u' ? read_hex4(p + 2) : 0;
+                    if (low >= 0xDC00 && low < 0xE000) {
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                        p += 6;
+                    } else {
+                        code_point = 0xFFFD;
+                    }
+                } else if (code_point >= 0xDC00 && code_point < 0xE000) {
+                    code_point = 0xFFFD;
+                }
+                write_utf8(alloc, code_point);
+                break;
+            }
+            default: write_byte(alloc, escaped); break;
+        }
+    }
+    return begin;
+}
+
+static void write_text(stack_alloc* alloc, string text) {
+    sa_alloc_copy(alloc, text.begin, text.end);
+}
+
+u8* json_write_string(stack_alloc* alloc, string text) {
+    static const char hex[] = "0123456789abcdef";
+    u8* begin = alloc->cursor;
+    const u8* p = text.begin;
+    const u8* end = text.end;
+    write_byte(alloc, '"');
+    while (p < end) {
+        const u8* run = p;
+        p = find_string_special(p, end);
+        sa_alloc_copy(alloc, run, p);
+        if (p == end) {
+            break;
+        }
+        const u8 c = *p++;
+        switch (c) {
+            case '"': write_text(alloc, STRING("\\\"")); break;
+            case '\\': write_text(alloc, STRING("\\\\")); break;
+            case '\b': write_text(alloc, STRING("\\b")); break;
+            case '\f': write_text(alloc, STRING("\\f")); break;
+            case '\n': write_text(alloc, STRING("\\n")); break;
+            case '\r': write_text(alloc, STRING("\\r")); break;
+            case '\t': write_text(alloc, STRING("\\t")); break;
+            default: {
+                u8* escape = sa_alloc(alloc, 6);
+                sa_copy(alloc, "\\u00", escape, 4);
+                escape[4] = (u8)hex[c >> 4];
+                escape[5] = (u8)hex[c & 0xF];
+                break;
+            }
+        }
+    }
+    write_byte(alloc, '"');
+    return begin;
+}
+
+static void write_signed(stack_alloc* alloc, i64 value) {
+    char* out = sa_alloc(alloc, CONVERT_U64_MAX_CHARS);
+    sa_free(alloc, convert_i64_to_decimal(value, out));
+}
+
+static void write_unsigned(stack_alloc* alloc, u64 value) {
+    char* out = sa_alloc(alloc, CONVERT_U64_MAX_CHARS);
+    sa_free(alloc, convert_u64_to_decimal(value, out));
+}
+
+static void write_f64(stack_alloc* alloc, f64 value) {
+    u64 bits;
+    __builtin_memcpy(&bits, &value, sizeof(bits));
+    if (((bits >> 52) & 0x7FF) == 0x7FF) {
+        write_text(alloc, STRING("null"));
+        return;
+    }
+    char* out = sa_alloc(alloc, CONVERT_F64_MAX_CHARS);
+    sa_free(alloc, convert_f64_to_chars(value, CONVERT_FLOAT_GENERAL, out));
+}
+
+static void write_value(stack_alloc* alloc, const meta* m, const u8* data) {
+    switch (m->pt) {
+        case PT_NONE: {
+            write_byte(alloc, '{');
+            for (const field_descriptor* field = m->fields.begin; field < m->fields.end; ++field) {
+                if (field != m->fields.begin) {
+                    write_byte(alloc, ',');
+                }
+                json_write_string(alloc, field->field_name);
+                write_byte(alloc, ':');
+                write_value(alloc, field->field_meta, data + field->offset);
+            }
+            write_byte(alloc, '}');
+        } break;
+        case PT_ARRAY: {
+            const meta* element_meta = m->array_element_meta;
+            const u8* begin = *(u8* const*)data;
+            const u8* end = *(u8* const*)byteoffset(data, sizeof(void*));
+            write_byte(alloc, '[');
+            for (const u8* element = begin; element < end; element += element_meta->type_size) {
+                if (element != begin) {
+                    write_byte(alloc, ',');
+                }
+                write_value(alloc, element_meta, element);
+            }
+            write_byte(alloc, ']');
+        } break;
+        case PT_STRING: json_write_string(alloc, *(const string*)data); break;
+        case PT_I8: write_signed(alloc, *(const i8*)data); break;
+        case PT_U8: write_unsigned(alloc, *(const u8*)data); break;
+        case PT_I16: write_signed(alloc, *(const i16*)data); break;
+        case PT_U16: write_unsigned(alloc, *(const u16*)data); break;
+        case PT_I32: write_signed(alloc, *(const i32*)data); break;
+        case PT_U32: write_unsigned(alloc, *(const u32*)data); break;
+        case PT_I64: write_signed(alloc, *(const i64*)data); break;
+        case PT_U64: write_unsigned(alloc, *(const u64*)data); break;
+        case PT_IPTR: write_signed(alloc, *(const iptr*)data); break;
+        case PT_UPTR: write_unsigned(alloc, *(const uptr*)data); break;
+        case PT_F64: write_f64(alloc, *(const f64*)data); break;
+    }
+}
+
+u8* json_encode(stack_alloc* alloc, const meta* m, const void* data) {
+    u8* begin = alloc->cursor;
+    write_value(alloc, m, data);
+    return begin;
+}
@@ -0,0 +1,81 @@
+#ifndef JSON_H
+#define JSON_H
+
+#include "primitive.h"
+#include "litteral.h"
+#include "stack_alloc.h"
+#include "meta.h"
+
+// JSON tokenizer
+//
+// The document is walked in a single pass without allocating. String and key tokens are slices
+// of the input between the quotes with the escapes left in place, json_unescape decodes them.
+// Strings are scanned 16 bytes at a time with SSE2 when available. The grammar is checked as
+// tokens are produced, an invalid document yields JSON_TOKEN_ERROR and then only errors.
+//
+// Example usage:
+//   json_tokenizer t;
+//   json_tokenizer_init(&t, body.begin, body.end);
+//   if (json_next(&t).type == JSON_TOKEN_OBJECT_BEGIN) {
+//       json_token id = json_object_find(&t, STRING("id"));
+//       if (id.type == JSON_TOKEN_STRING) {
+//           u8* text = json_unescape(alloc, id.text);
+//       }
+//   }
+
+typedef enum {
+    JSON_TOKEN_END,             // End of the document
+    JSON_TOKEN_ERROR,
+    JSON_TOKEN_OBJECT_BEGIN,
+    JSON_TOKEN_OBJECT_END,
+    JSON_TOKEN_ARRAY_BEGIN,
+    JSON_TOKEN_ARRAY_END,
+    JSON_TOKEN_KEY,
+    JSON_TOKEN_STRING,
+    JSON_TOKEN_NUMBER,
+    JSON_TOKEN_TRUE,
+    JSON_TOKEN_FALSE,
+    JSON_TOKEN_NULL
+} json_token_type;
+
+typedef struct {
+    json_token_type type;
+    string text;                // Raw text of the token, without the quotes for keys and strings
+} json_token;
+
+// Deepest nesting of objects and arrays
+#define JSON_MAX_DEPTH 64
+
+typedef struct {
+    const u8* cursor;
+    const u8* end;
+    u64 object_levels;          // One bit per nesting level, set for objects
+    u32 depth;
+    u32 state;
+} json_tokenizer;
+
+void json_tokenizer_init(json_tokenizer* t, const void* begin, const void* end);
+json_token json_next(json_tokenizer* t);
+
+// Skip the content of the value starting with token, returns the last token of the value.
+json_token json_skip(json_tokenizer* t, json_token token);
+
+// Inside an object, advance to the value of key and return its first token. Keys are compared
+// without decoding their escapes. Returns JSON_TOKEN_OBJECT_END if the object has no such key.
+json_token json_object_find(json_tokenizer* t, string key);
+
+// Decode the escapes of a string token to UTF-8, allocated from alloc (end is alloc->cursor).
+// Unpaired surrogates become U+FFFD.
+u8* json_unescape(stack_alloc* alloc, string text);
+
+// JSON encoder
+//
+// Structs become objects keyed by field name, arrays become arrays, strings are escaped and
+// numbers written in their shortest form (non finite f64 values as null).
+
+// Write text as a quoted JSON string, returns the beginning (end is alloc->cursor).
+u8* json_write_string(stack_alloc* alloc, string text);
+// Write the value at data, returns the beginning (end is alloc->cursor).
+u8* json_encode(stack_alloc* alloc, const meta* m, const void* data);
+
+#endif /* JSON_H */
@@ -0,0 +1,349 @@
+#include "log.h"
+#include "assert.h"
+#include "mem.h"
+#include "meta_plan.h"
+#include "system_time.h"
+#include "thread.h"
+
+#include <pthread.h>
+
+// Time between two rounds of the background thread
+#define LOG_FLUSH_INTERVAL_US 1000
+
+// Record header, followed by one 8 byte slot per argument. Strings and %m text are stored as
+// their length followed by the bytes, padded to 8.
+typedef struct {
+    u32 size;                   // Bytes of the record and its arguments
+    u32 unused_;
+    const log_site* site;       // 0 for the padding up to the end of the ring
+    u64 time_ns;
+} log_record;
+
+typedef struct log_ring {
+    struct log_ring* next;
+    u8* data;
+    u32 released;               // The owner thread exited, the next thread to log takes the ring over
+    u64 head __attribute__((aligned(64)));  // Written by the owner
+    u64 cached_tail;            // Last tail seen by the owner
+    u64 tail __attribute__((aligned(64)));  // Written under log_output_mutex
+} log_ring;
+
+u32 log_runtime_level = LOG_LEVEL_INFO;
+
+static log_ring* log_rings;
+static pthread_mutex_t log_output_mutex = PTHREAD_MUTEX_INITIALIZER;
+static file_t log_file;
+static u32 log_started;
+static u32 log_stopping;
+static pthread_t log_flusher;
+static pthread_once_t log_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t log_ring_key;
+static __thread log_ring* log_thread_ring;
+static u64 log_epoch_ns;
+
+static const string log_level_names[] = {
+    STR("DEBUG"),
+    STR("INFO "),
+    STR("WARN "),
+    STR("ERROR"),
+};
+
+void log_set_level(log_level level) {
+    __atomic_store_n(&log_runtime_level, (u32)level, __ATOMIC_RELAXED);
+}
+
+static uptr log_align(uptr size) {
+    return (size + 7) & ~(uptr)7;
+}
+
+static file_t log_output(void) {
+    return __atomic_load_n(&log_started, __ATOMIC_ACQUIRE) ? log_file : file_stdout();
+}
+
+static void log_padding(file_writer* writer, u32 padding) {
+    char spaces[FORMAT_SPEC_MAX_WIDTH];
+    __builtin_memset(spaces, ' ', padding);
+    file_writer_write(writer, spaces, spaces + padding);
+}
+
+static void log_write_prefix(file_writer* writer, log_level level, u64 time_ns) {
+    const u64 epoch = __atomic_load_n(&log_epoch_ns, __ATOMIC_RELAXED);
+    const u64 elapsed_us = time_ns > epoch ? (time_ns - epoch) / 1000 : 0;
+    PRINT_FORMAT_TO_WRITER(writer, STRING("%4llu.%06llu %s "), elapsed_us / 1000000, elapsed_us % 1000000, log_level_names[level]);
+}
+
+static void log_write_record(file_writer* writer, const log_record* record) {
+    const log_site* site = record->site;
+    // The thread that parsed the format first is storing the segments
+    while (__atomic_load_n(&site->compiled.state, __ATOMIC_ACQUIRE) != 2) {}
+
+    log_write_prefix(writer, site->level, record->time_ns);
+    const u8* argument = (const u8*)(record + 1);
+    for (const print_format_segment* segment = site->compiled.segments; segment < site->compiled.segments + site->compiled.count; ++segment) {
+        const format_spec* spec = &segment->spec;
+        if (spec->conversion == 0) {
+            file_writer_write(writer, segment->begin, segment->end);
+        } else if (spec->conversion == 's' || spec->conversion == 'm') {
+            const u64 length = *(const u64*)argument;
+            const u8* text = argument + sizeof(u64);
+            const u32 padding = spec->conversion == 's' ? format_spec_padding(spec, length) : 0;
+            if (!spec->left_align) {
+                log_padding(writer, padding);
+            }
+            file_writer_write(writer, text, text + length);
+            if (spec->left_align) {
+                log_padding(writer, padding);
+            }
+            argument += sizeof(u64) + log_align(length);
+        } else {
+            char text[FORMAT_SPEC_MAX_CHARS];
+            char* end = format_spec_write_value(spec, *(const u64*)argument, text);
+            file_writer_write(writer, text, end);
+            argument += sizeof(u64);
+        }
+    }
+    file_writer_write(writer, "\n", (const char*)"\n" + 1);
+}
+
+// Oldest record of ring, skipping the padding at the end of the ring
+static const log_record* log_ring_peek(log_ring* ring) {
+    const u64 head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    u64 tail = ring->tail;
+    while (tail != head) {
+        const uptr offset = tail & (LOG_RING_SIZE - 1);
+        if (LOG_RING_SIZE - offset < sizeof(log_record)) {
+            // Too short for a header, records never start there
+            tail += LOG_RING_SIZE - offset;
+            __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+            continue;
+        }
+        const log_record* record = (const log_record*)(ring->data + offset);
+        if (record->site) {
+            return record;
+        }
+        tail += record->size;
+        __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+    }
+    return 0;
+}
+
+// Write the records of all rings in time order, with log_output_mutex held
+static void log_drain_locked(file_writer* writer) {
+    while (1) {
+        log_ring* oldest = 0;
+        const log_record* oldest_record = 0;
+        for (log_ring* ring = __atomic_load_n(&log_rings, __ATOMIC_ACQUIRE); ring; ring = ring->next) {
+            const log_record* record = log_ring_peek(ring);
+            if (record && (!oldest_record || record->time_ns < oldest_record->time_ns)) {
+                oldest = ring;
+                oldest_record = record;
+            }
+        }
+        if (!oldest) {
+            return;
+        }
+        log_write_record(writer, oldest_record);
+        __atomic_store_n(&oldest->tail, oldest->tail + oldest_record->size, __ATOMIC_RELEASE);
+    }
+}
+
+void log_flush(void) {
+    u8 buffer[4096];
+    pthread_mutex_lock(&log_output_mutex);
+    file_writer writer;
+    file_writer_init(&writer, log_output(), buffer, byteoffset(buffer, sizeof(buffer)));
+    log_drain_locked(&writer);
+    file_writer_flush(&writer);
+    pthread_mutex_unlock(&log_output_mutex);
+}
+
+static void log_ring_release(void* ring) {
+    __atomic_store_n(&((log_ring*)ring)->released, 1, __ATOMIC_RELEASE);
+}
+
+static void log_ring_key_create(void) {
+    pthread_key_create(&log_ring_key, log_ring_release);
+}
+
+// Ring of the calling thread, taken over from an exited thread or added to the list
+static log_ring* log_ring_acquire(void) {
+    pthread_once(&log_key_once, log_ring_key_create);
+
+    log_ring* ring = 0;
+    for (log_ring* r = __atomic_load_n(&log_rings, __ATOMIC_ACQUIRE); r; r = r->next) {
+        u32 released = 1;
+        if (__atomic_compare_exchange_n(&r->released, &released, 0, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            ring = r;
+            break;
+        }
+    }
+    if (!ring) {
+        ring = mem_map(sizeof(log_ring) + LOG_RING_SIZE);
+        ring->data = byteoffset(ring, sizeof(log_ring));
+        ring->next = __atomic_load_n(&log_rings, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&log_rings, &ring->next, ring, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {}
+    }
+    pthread_setspecific(log_ring_key, ring);
+    log_thread_ring = ring;
+    return ring;
+}
+
+// Append a record to the ring of the calling thread, returns 0 if it has to be written directly
+static u8 log_append(const log_site* site, const print_compiled_format* parsed, u64 time_ns, va_list args) {
+    const print_format_segment* segments_end = parsed->segments + parsed->count;
+
+    // Upper bound of the record size
+    uptr size = sizeof(log_record);
+    va_list sizing;
+    va_copy(sizing, args);
+    for (const print_format_segment* segment = parsed->segments; segment < segments_end; ++segment) {
+        switch (segment->spec.conversion) {
+            case 0: break;
+            case 's': {
+                const string value = va_arg(sizing, const string);
+                size += sizeof(u64) + log_align(value.begin && value.end ? bytesize(value.begin, value.end) : 6);
+            } break;
+            case 'm': {
+                va_arg(sizing, const meta*);
+                va_arg(sizing, const void*);
+                size += sizeof(u64) + LOG_META_MAX_CHARS;
+            } break;
+            default:
+                format_spec_read_arg(&segment->spec, &sizing);
+                size += sizeof(u64);
+                break;
+        }
+    }
+    va_end(sizing);
+    if (size > LOG_RECORD_MAX) {
+        return 0;
+    }
+
+    log_ring* ring = log_thread_ring ? log_thread_ring : log_ring_acquire();
+    u64 head = ring->head;
+    uptr offset = head & (LOG_RING_SIZE - 1);
+    const uptr padding = LOG_RING_SIZE - offset < size ? LOG_RING_SIZE - offset : 0;
+    while (LOG_RING_SIZE - (head - ring->cached_tail) < padding + size) {
+        ring->cached_tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        if (LOG_RING_SIZE - (head - ring->cached_tail) < padding + size) {
+            // Full, format the pending records on this thread
+            log_flush();
+        }
+    }
+    // A tail shorter than a header is skipped without a marker, log_ring_peek knows it
+    if (padding >= sizeof(log_record)) {
+        log_record* skip = (log_record*)(ring->data + offset);
+        skip->size = (u32)padding;
+        skip->site = 0;
+    }
+    if (padding) {
+        offset = 0;
+    }
+
+    log_record* record = (log_record*)(ring->data + offset);
+    u8* out = (u8*)(record + 1);
+    va_list arguments;
+    va_copy(arguments, args);
+    for (const print_format_segment* segment = parsed->segments; segment < segments_end; ++segment) {
+        switch (segment->spec.conversion) {
+            case 0: break;
+            case 's': {
+                string value = va_arg(arguments, const string);
+                if (!value.begin || !value.end) {
+                    value = STRING("(null)");
+                }
+                const uptr length = bytesize(value.begin, value.end);
+                *(u64*)out = length;
+                __builtin_memcpy(out + sizeof(u64), value.begin, length);
+                out += sizeof(u64) + log_align(length);
+            } break;
+            case 'm': {
+                const meta* m = va_arg(arguments, const meta*);
+                meta_plan_cursor cursor;
+                meta_plan_cursor_init(&cursor, meta_plan_get(m), va_arg(arguments, const void*));
+                char* text = (char*)(out + sizeof(u64));
+                char* end = meta_plan_write(&cursor, text, text + LOG_META_MAX_CHARS);
+                if (!meta_plan_cursor_done(&cursor)) {
+                    va_end(arguments);
+                    return 0;
+                }
+                *(u64*)out = bytesize(text, end);
+                out += sizeof(u64) + log_align(bytesize(text, end));
+            } break;
+            default:
+                *(u64*)out = format_spec_read_arg(&segment->spec, &arguments);
+                out += sizeof(u64);
+                break;
+        }
+    }
+    va_end(arguments);
+
+    record->size = (u32)bytesize(record, out);
+    record->site = site;
+    record->time_ns = time_ns;
+    __atomic_store_n(&ring->head, head + padding + record->size, __ATOMIC_RELEASE);
+    return 1;
+}
+
+// Write the pending records, then the line of this call
+static void log_write_now(log_site* site, string format, u64 time_ns, va_list args) {
+    u8 buffer[1024];
+    pthread_mutex_lock(&log_output_mutex);
+    file_writer writer;
+    file_writer_init(&writer, log_output(), buffer, byteoffset(buffer, sizeof(buffer)));
+    log_drain_locked(&writer);
+    log_write_prefix(&writer, site->level, time_ns);
+    print_format_compiled_va(&writer, &site->compiled, format, args);
+    file_writer_write(&writer, "\n", (const char*)"\n" + 1);
+    file_writer_flush(&writer);
+    pthread_mutex_unlock(&log_output_mutex);
+}
+
+void log_write(log_site* site, string format, ...) {
+    const u64 time_ns = sys_time_monotonic_ns();
+    if (!__atomic_load_n(&log_epoch_ns, __ATOMIC_RELAXED)) {
+        u64 expected = 0;
+        __atomic_compare_exchange_n(&log_epoch_ns, &expected, time_ns, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+
+    va_list args;
+    va_start(args, format);
+    print_compiled_format local;
+    const print_compiled_format* parsed = print_format_compile(&site->compiled, format, &local);
+    if (!__atomic_load_n(&log_started, __ATOMIC_ACQUIRE) || parsed->fallback || !log_append(site, parsed, time_ns, args)) {
+        log_write_now(site, format, time_ns, args);
+    }
+    va_end(args);
+}
+
+static void* log_flusher_main(void* arg) {
+    unused(arg);
+    while (!__atomic_load_n(&log_stopping, __ATOMIC_ACQUIRE)) {
+        log_flush();
+        thread_current_sleep_until_us(sys_time_us() + LOG_FLUSH_INTERVAL_US);
+    }
+    log_flush();
+    return 0;
+}
+
+void log_start(file_t file) {
+    debug_assert(!log_started);
+    log_file = file;
+    __atomic_store_n(&log_stopping, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&log_started, 1, __ATOMIC_RELEASE);
+    if (pthread_create(&log_flusher, 0, log_flusher_main, 0) != 0) {
+        // Without the background thread every line is written directly
+        __atomic_store_n(&log_started, 0, __ATOMIC_RELEASE);
+    }
+}
+
+void log_stop(void) {
+    if (!__atomic_load_n(&log_started, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+    __atomic_store_n(&log_stopping, 1, __ATOMIC_RELEASE);
+    pthread_join(log_flusher, 0);
+    // Records appended while the background thread was finishing
+    log_flush();
+    __atomic_store_n(&log_started, 0, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,83 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include "primitive.h"
+#include "litteral.h"
+#include "file.h"
+#include "print.h"
+
+// Leveled logging
+//
+// Each call site parses its format once (see PRINT_FORMAT) and writes one line:
+//   "   0.001234 INFO  message\n", the time being seconds since the first record.
+// Call sites below LOG_COMPILED_LEVEL are removed by the compiler, the others check the runtime
+// level with a single load.
+//
+// Until log_start, lines are written on the calling thread to file_stdout. After log_start each
+// thread appends binary records (call site, time, argument values) to its own lock free ring and
+// a background thread formats them, in time order, to the log file. Strings are copied into the
+// record and %m values rendered into it, so arguments can be released right after the call.
+// A thread finding its ring full formats the pending records itself. Records larger than
+// LOG_RECORD_MAX and formats of more than PRINT_FORMAT_MAX_SEGMENTS segments are written on the
+// calling thread, after the pending records.
+//
+// Example usage:
+//   log_start(file_stdout());
+//   LOG_INFO(STRING("Built %s in %llums"), name, elapsed_ms);
+//   log_stop();
+
+typedef enum {
+    LOG_LEVEL_DEBUG,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_ERROR,
+    LOG_LEVEL_NONE
+} log_level;
+
+#ifndef LOG_COMPILED_LEVEL
+#if DEBUG_ASSERTIONS_ENABLED
+#define LOG_COMPILED_LEVEL LOG_LEVEL_DEBUG
+#else
+#define LOG_COMPILED_LEVEL LOG_LEVEL_INFO
+#endif
+#endif
+
+// Bytes of the ring of each logging thread
+#define LOG_RING_SIZE (64 * 1024)
+// Largest record kept in a ring
+#define LOG_RECORD_MAX (LOG_RING_SIZE / 4)
+// Longest %m text kept in a record
+#define LOG_META_MAX_CHARS 1024
+
+typedef struct {
+    log_level level;
+    print_compiled_format compiled;
+} log_site;
+
+// Lowest level written, LOG_LEVEL_INFO by default
+extern u32 log_runtime_level;
+void log_set_level(log_level level);
+
+// Format records on a background thread, to file. Lines are written to file_stdout again after
+// log_stop, which writes the pending records. Call log_stop once the other threads stopped
+// logging.
+void log_start(file_t file);
+void log_stop(void);
+// Write the pending records of all threads.
+void log_flush(void);
+
+void log_write(log_site* site, string format, ...);
+
+#define LOG(site_level, ...) do { \
+    if ((site_level) >= LOG_COMPILED_LEVEL && (u32)(site_level) >= __atomic_load_n(&log_runtime_level, __ATOMIC_RELAXED)) { \
+        static log_site log_site_ = {.level = (site_level)}; \
+        log_write(&log_site_, __VA_ARGS__); \
+    } \
+} while (0)
+
+#define LOG_DEBUG(...) LOG(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define LOG_INFO(...) LOG(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_WARN(...) LOG(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_ERROR(...) LOG(LOG_LEVEL_ERROR, __VA_ARGS__)
+
+#endif /* LOG_H */
@@ -13,7 +13,7 @@ typedef enum {
     PT_NONE,  // For structs/complex types
     PT_I8, PT_U8, PT_I16, PT_U16,
     PT_I32, PT_U32, PT_I64, PT_U64,
-    PT_IPTR, PT_UPTR, PT_ARRAY
+    PT_IPTR, PT_UPTR, PT_F64, PT_STRING, PT_ARRAY
 } primitive_type;
 
 // Meta structure for describing how to print any type
@@ -106,4 +106,19 @@ static const meta uptr_meta = {
     .fields = {0,0},
 };
 
+static const meta f64_meta = {
+    .type_name = STR("f64"),
+    .type_size = sizeof(f64),
+    .pt = PT_F64,
+    .fields = {0,0},
+};
+
+// Text slice, the field is a string {begin, end}
+static const meta string_meta = {
+    .type_name = STR("string"),
+    .type_size = sizeof(string),
+    .pt = PT_STRING,
+    .fields = {0,0},
+};
+
 #endif /* META_H */
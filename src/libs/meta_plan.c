@@ -0,0 +1,312 @@
+#include "meta_plan.h"
+#include "assert.h"
+#include "mem.h"
+
+// Number of distinct metas a cache table holds, a power of two. A full table is followed by
+// another one.
+#define PLAN_CACHE_SLOTS 1024
+// Plans are stored in blocks of this size, never released
+#define PLAN_BLOCK_SIZE (64 * 1024)
+
+typedef enum {
+    PLAN_OP_TEXT,               // text_begin, text_end
+    PLAN_OP_PRIMITIVE,          // pt, offset
+    PLAN_OP_ARRAY_BEGIN,        // offset, jump to the op after the matching PLAN_OP_ARRAY_END
+    PLAN_OP_ARRAY_END           // element_size, jump to the first op of the element
+} plan_op_kind;
+
+typedef struct {
+    u8 kind;
+    u8 pt;
+    u32 offset;
+    u32 element_size;
+    u32 jump;
+    u32 text_begin;
+    u32 text_end;
+} plan_op;
+
+struct meta_plan {
+    const plan_op* ops;
+    const char* text;
+    u32 op_count;
+};
+
+typedef struct {
+    plan_op* ops;               // 0 while counting
+    char* text;
+    u32 op_count;
+    u32 text_size;
+    u32 array_depth;
+    u8 last_is_text;
+} plan_compiler;
+
+static void plan_emit_text(plan_compiler* c, string text) {
+    const u32 size = (u32)bytesize(text.begin, text.end);
+    if (c->ops) {
+        __builtin_memcpy(c->text + c->text_size, text.begin, size);
+    }
+    // Text following text extends the same op
+    if (!c->last_is_text) {
+        if (c->ops) {
+            c->ops[c->op_count] = (plan_op){.kind = PLAN_OP_TEXT, .text_begin = c->text_size};
+        }
+        c->op_count += 1;
+        c->last_is_text = 1;
+    }
+    c->text_size += size;
+    if (c->ops) {
+        c->ops[c->op_count - 1].text_end = c->text_size;
+    }
+}
+
+static u32 plan_emit_op(plan_compiler* c, plan_op op) {
+    if (c->ops) {
+        c->ops[c->op_count] = op;
+    }
+    c->last_is_text = 0;
+    return c->op_count++;
+}
+
+static void plan_compile(plan_compiler* c, const meta* m, u32 offset) {
+    switch (m->pt) {
+        case PT_NONE: {
+            plan_emit_text(c, m->type_name);
+            plan_emit_text(c, STRING(" {"));
+            for (const field_descriptor* field = m->fields.begin; field < m->fields.end; ++field) {
+                if (field != m->fields.begin) {
+                    plan_emit_text(c, STRING(", "));
+                }
+                plan_emit_text(c, field->field_name);
+                plan_emit_text(c, STRING(": "));
+                plan_compile(c, field->field_meta, offset + (u32)field->offset);
+            }
+            plan_emit_text(c, STRING("}"));
+        } break;
+        case PT_ARRAY: {
+            const u32 element_size = (u32)m->array_element_meta->type_size;
+            debug_assert(element_size > 0);
+            const u32 begin = plan_emit_op(c, (plan_op){.kind = PLAN_OP_ARRAY_BEGIN, .offset = offset});
+            c->array_depth += 1;
+            debug_assert(c->array_depth <= META_PLAN_MAX_ARRAY_DEPTH);
+            plan_compile(c, m->array_element_meta, 0);
+            c->array_depth -= 1;
+            const u32 end = plan_emit_op(c, (plan_op){.kind = PLAN_OP_ARRAY_END, .element_size = element_size, .jump = begin + 1});
+            if (c->ops) {
+                c->ops[begin].jump = end + 1;
+            }
+        } break;
+        default:
+            plan_emit_op(c, (plan_op){.kind = PLAN_OP_PRIMITIVE, .pt = (u8)m->pt, .offset = offset});
+            break;
+    }
+}
+
+typedef struct {
+    const meta* key;
+    const meta_plan* plan;
+} plan_slot;
+
+typedef struct plan_table {
+    plan_slot slots[PLAN_CACHE_SLOTS];
+    struct plan_table* next;    // Set once this table is full
+} plan_table;
+
+static plan_table plan_cache;
+static u32 plan_cache_lock;
+static u8* plan_block_cursor;
+static u8* plan_block_end;
+
+static void* plan_block_alloc(uptr size) {
+    size = (size + 7) & ~(uptr)7;
+    if (!plan_block_cursor || size > bytesize(plan_block_cursor, plan_block_end)) {
+        const uptr block_size = size > PLAN_BLOCK_SIZE ? size : PLAN_BLOCK_SIZE;
+        plan_block_cursor = mem_map(block_size);
+        plan_block_end = byteoffset(plan_block_cursor, block_size);
+    }
+    void* result = plan_block_cursor;
+    plan_block_cursor += size;
+    return result;
+}
+
+static const meta_plan* plan_build(const meta* m) {
+    plan_compiler c = {0};
+    plan_compile(&c, m, 0);
+
+    const uptr ops_size = sizeof(plan_op) * c.op_count;
+    meta_plan* plan = plan_block_alloc(sizeof(*plan) + ops_size + c.text_size);
+    c.ops = byteoffset(plan, sizeof(*plan));
+    c.text = byteoffset(c.ops, ops_size);
+    c.op_count = 0;
+    c.text_size = 0;
+    c.last_is_text = 0;
+    plan_compile(&c, m, 0);
+
+    plan->ops = c.ops;
+    plan->text = c.text;
+    plan->op_count = c.op_count;
+    return plan;
+}
+
+// Cached plan of m, 0 if there is none. Published slots never change, they are read without the
+// lock. Slots are never emptied, so m is not in the tables after the one where an empty slot is
+// reached.
+static const meta_plan* plan_cache_find(const meta* m, uptr start) {
+    for (plan_table* table = &plan_cache; table; table = __atomic_load_n(&table->next, __ATOMIC_ACQUIRE)) {
+        for (uptr i = 0; i < PLAN_CACHE_SLOTS; ++i) {
+            plan_slot* slot = &table->slots[(start + i) & (PLAN_CACHE_SLOTS - 1)];
+            const meta* key = __atomic_load_n(&slot->key, __ATOMIC_ACQUIRE);
+            if (key == m) {
+                return slot->plan;
+            }
+            if (!key) {
+                return 0;
+            }
+        }
+    }
+    return 0;
+}
+
+const meta_plan* meta_plan_get(const meta* m) {
+    const uptr mask = PLAN_CACHE_SLOTS - 1;
+    const uptr start = (uptr)(((u64)(uptr)m * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+
+    const meta_plan* cached = plan_cache_find(m, start);
+    if (cached) {
+        return cached;
+    }
+
+    while (__atomic_exchange_n(&plan_cache_lock, 1, __ATOMIC_ACQUIRE)) {}
+    const meta_plan* plan = 0;
+    for (plan_table* table = &plan_cache; !plan; table = table->next) {
+        for (uptr i = 0; i < PLAN_CACHE_SLOTS; ++i) {
+            plan_slot* slot = &table->slots[(start + i) & mask];
+            if (slot->key == m) {
+                plan = slot->plan;
+                break;
+            }
+            if (!slot->key) {
+                plan = plan_build(m);
+                slot->plan = plan;
+                __atomic_store_n(&slot->key, m, __ATOMIC_RELEASE);
+                break;
+            }
+        }
+        if (!plan && !table->next) {
+            __atomic_store_n(&table->next, mem_map(sizeof(plan_table)), __ATOMIC_RELEASE);
+        }
+    }
+    __atomic_store_n(&plan_cache_lock, 0, __ATOMIC_RELEASE);
+    return plan;
+}
+
+void meta_plan_cursor_init(meta_plan_cursor* cursor, const meta_plan* plan, const void* data) {
+    cursor->plan = plan;
+    cursor->op = 0;
+    cursor->array_depth = 0;
+    cursor->base = data;
+    cursor->text = 0;
+    cursor->text_end = 0;
+}
+
+u8 meta_plan_cursor_done(const meta_plan_cursor* cursor) {
+    return cursor->op == cursor->plan->op_count && cursor->text == cursor->text_end;
+}
+
+static char* plan_write_primitive(u8 pt, const u8* data, char* out) {
+    switch (pt) {
+        case PT_I8: return convert_i64_to_decimal(*(const i8*)data, out);
+        case PT_U8: return convert_u64_to_decimal(*(const u8*)data, out);
+        case PT_I16: return convert_i64_to_decimal(*(const i16*)data, out);
+        case PT_U16: return convert_u64_to_decimal(*(const u16*)data, out);
+        case PT_I32: return convert_i64_to_decimal(*(const i32*)data, out);
+        case PT_U32: return convert_u64_to_decimal(*(const u32*)data, out);
+        case PT_I64: return convert_i64_to_decimal(*(const i64*)data, out);
+        case PT_U64: return convert_u64_to_decimal(*(const u64*)data, out);
+        case PT_IPTR: return convert_i64_to_decimal(*(const iptr*)data, out);
+        case PT_UPTR: return convert_u64_to_decimal(*(const uptr*)data, out);
+        case PT_F64: return convert_f64_to_chars(*(const f64*)data, CONVERT_FLOAT_GENERAL, out);
+        default: {
+            const string unknown = STR("<unknown primitive>");
+            __builtin_memcpy(out, unknown.begin, bytesize(unknown.begin, unknown.end));
+            return out + bytesize(unknown.begin, unknown.end);
+        }
+    }
+}
+
+char* meta_plan_write(meta_plan_cursor* cursor, char* begin, char* end) {
+    const meta_plan* plan = cursor->plan;
+    char* out = begin;
+    for (;;) {
+        if (cursor->text != cursor->text_end) {
+            const uptr available = bytesize(out, end);
+            const uptr pending = bytesize(cursor->text, cursor->text_end);
+            const uptr size = pending < available ? pending : available;
+            __builtin_memcpy(out, cursor->text, size);
+            out += size;
+            cursor->text += size;
+            if (cursor->text != cursor->text_end) {
+                return out;
+            }
+        }
+        if (cursor->op == plan->op_count) {
+            return out;
+        }
+
+        const plan_op* op = &plan->ops[cursor->op];
+        switch (op->kind) {
+            case PLAN_OP_TEXT:
+                cursor->text = plan->text + op->text_begin;
+                cursor->text_end = plan->text + op->text_end;
+                cursor->op += 1;
+                break;
+            case PLAN_OP_PRIMITIVE: {
+                const u8* data = cursor->base + op->offset;
+                if (op->pt == PT_STRING) {
+                    cursor->text = ((const string*)data)->begin;
+                    cursor->text_end = ((const string*)data)->end;
+                } else {
+                    if (bytesize(out, end) < META_PLAN_MIN_BUFFER) {
+                        return out;
+                    }
+                    out = plan_write_primitive(op->pt, data, out);
+                }
+                cursor->op += 1;
+            } break;
+            case PLAN_OP_ARRAY_BEGIN: {
+                const u8* const* array = (const u8* const*)(cursor->base + op->offset);
+                if (array[0] == array[1]) {
+                    cursor->text = "[]";
+                    cursor->text_end = cursor->text + 2;
+                    cursor->op = op->jump;
+                    break;
+                }
+                debug_assert(cursor->array_depth < META_PLAN_MAX_ARRAY_DEPTH);
+                cursor->arrays[cursor->array_depth].element = array[0];
+                cursor->arrays[cursor->array_depth].end = array[1];
+                cursor->arrays[cursor->array_depth].base = cursor->base;
+                cursor->array_depth += 1;
+                cursor->base = array[0];
+                cursor->text = "[";
+                cursor->text_end = cursor->text + 1;
+                cursor->op += 1;
+            } break;
+            case PLAN_OP_ARRAY_END: {
+                const u32 depth = cursor->array_depth - 1;
+                const u8* next = cursor->arrays[depth].element + op->element_size;
+                if (next < cursor->arrays[depth].end) {
+                    cursor->arrays[depth].element = next;
+                    cursor->base = next;
+                    cursor->text = ", ";
+                    cursor->text_end = cursor->text + 2;
+                    cursor->op = op->jump;
+                } else {
+                    cursor->base = cursor->arrays[depth].base;
+                    cursor->array_depth = depth;
+                    cursor->text = "]";
+                    cursor->text_end = cursor->text + 1;
+                    cursor->op += 1;
+                }
+            } break;
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef META_PLAN_H
+#define META_PLAN_H
+
+#include "primitive.h"
+#include "meta.h"
+#include "convert.h"
+
+// Flattened print plans for meta described values (%m)
+//
+// A meta tree is compiled once into a linear list of ops: literal text (type names, field names
+// and separators merged together), primitive reads at a byte offset and array loops. Plans are
+// cached per meta for the lifetime of the process, so printing a value is a single loop over
+// the ops, without walking the meta tree or allocating.
+//
+// The text is written in chunks to a caller buffer, values of any size print through a fixed
+// buffer of at least META_PLAN_MIN_BUFFER bytes.
+//
+// Example usage:
+//   meta_plan_cursor cursor;
+//   meta_plan_cursor_init(&cursor, meta_plan_get(&complex_meta), &value);
+//   while (!meta_plan_cursor_done(&cursor)) {
+//       char* end = meta_plan_write(&cursor, buffer, buffer + sizeof(buffer));
+//       file_write(file, buffer, end);
+//   }
+
+typedef struct meta_plan meta_plan;
+
+// Deepest nesting of arrays in a printed value
+#define META_PLAN_MAX_ARRAY_DEPTH 16
+// Smallest buffer meta_plan_write makes progress with, the longest primitive text
+#define META_PLAN_MIN_BUFFER CONVERT_F64_MAX_CHARS
+
+// Plan of m, compiled on the first call. Thread safe.
+const meta_plan* meta_plan_get(const meta* m);
+
+typedef struct {
+    const meta_plan* plan;
+    u32 op;                     // Next op to run
+    u32 array_depth;
+    const u8* base;             // Value the offsets of the ops are relative to
+    const char* text;           // Text not written yet
+    const char* text_end;
+    struct {
+        const u8* element;
+        const u8* end;
+        const u8* base;         // Base outside of the array
+    } arrays[META_PLAN_MAX_ARRAY_DEPTH];
+} meta_plan_cursor;
+
+void meta_plan_cursor_init(meta_plan_cursor* cursor, const meta_plan* plan, const void* data);
+u8 meta_plan_cursor_done(const meta_plan_cursor* cursor);
+// Write as much text as fits in [begin, end), returns the end of the written text.
+char* meta_plan_write(meta_plan_cursor* cursor, char* begin, char* end);
+
+#endif /* META_PLAN_H */
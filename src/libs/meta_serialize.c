@@ -0,0 +1,218 @@
+#include "meta_serialize.h"
+#include "assert.h"
+
+#define HOST_IS_LITTLE_ENDIAN (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+
+// A value is packed when its serialized bytes are exactly its memory bytes
+static u8 meta_is_packed(const meta* m) {
+    if (m->pt == PT_ARRAY || m->pt == PT_STRING) {
+        return 0;
+    }
+    if (m->pt != PT_NONE) {
+        return HOST_IS_LITTLE_ENDIAN || m->type_size == 1;
+    }
+    uptr cursor = 0;
+    for (const field_descriptor* field = m->fields.begin; field < m->fields.end; ++field) {
+        if (field->offset != cursor || !meta_is_packed(field->field_meta)) {
+            return 0;
+        }
+        cursor += field->field_meta->type_size;
+    }
+    return cursor == m->type_size;
+}
+
+// Fewest bytes a serialized value of m takes
+static uptr meta_serialized_minimum(const meta* m) {
+    if (m->pt == PT_ARRAY || m->pt == PT_STRING) {
+        return sizeof(u64);
+    }
+    if (m->pt != PT_NONE) {
+        return m->type_size;
+    }
+    uptr size = 0;
+    for (const field_descriptor* field = m->fields.begin; field < m->fields.end; ++field) {
+        size += meta_serialized_minimum(field->field_meta);
+    }
+    return size;
+}
+
+static void write_primitive(stack_alloc* alloc, const u8* data, uptr size) {
+    u8* out = sa_alloc(alloc, size);
+    for (uptr i = 0; i < size; ++i) {
+        out[i] = HOST_IS_LITTLE_ENDIAN ? data[i] : data[size - 1 - i];
+    }
+}
+
+static void write_value(stack_alloc* alloc, const meta* m, const u8* data);
+
+static void write_array(stack_alloc* alloc, const meta* m, const u8* data) {
+    const meta* element_meta = m->array_element_meta;
+    const u8* begin = *(u8* const*)data;
+    const u8* end = *(u8* const*)byteoffset(data, sizeof(void*));
+    const u64 count = element_meta->type_size ? bytesize(begin, end) / element_meta->type_size : 0;
+    write_primitive(alloc, (const u8*)&count, sizeof(count));
+
+    if (meta_is_packed(element_meta)) {
+        sa_alloc_copy(alloc, begin, end);
+        return;
+    }
+    for (const u8* element = begin; element < end; element += element_meta->type_size) {
+        write_value(alloc, element_meta, element);
+    }
+}
+
+static void write_string(stack_alloc* alloc, const string* text) {
+    const u64 size = bytesize(text->begin, text->end);
+    write_primitive(alloc, (const u8*)&size, sizeof(size));
+    sa_alloc_copy(alloc, text->begin, text->end);
+}
+
+static void write_struct(stack_alloc* alloc, const meta* m, const u8* data) {
+    // Runs of packed fields following each other in memory are copied at once
+    uptr run_begin = 0;
+    uptr run_end = 0;
+    for (const field_descriptor* field = m->fields.begin; field < m->fields.end; ++field) {
+        const meta* field_meta = field->field_meta;
+        if (meta_is_packed(field_meta)) {
+            if (field->offset != run_end) {
+                sa_alloc_copy(alloc, data + run_begin, data + run_end);
+                run_begin = field->offset;
+            }
+            run_end = field->offset + field_meta->type_size;
+            continue;
+        }
+        sa_alloc_copy(alloc, data + run_begin, data + run_end);
+        run_begin = run_end = 0;
+        write_value(alloc, field_meta, data + field->offset);
+    }
+    sa_alloc_copy(alloc, data + run_begin, data + run_end);
+}
+
+static void write_value(stack_alloc* alloc, const meta* m, const u8* data) {
+    switch (m->pt) {
+        case PT_NONE: write_struct(alloc, m, data); break;
+        case PT_ARRAY: write_array(alloc, m, data); break;
+        case PT_STRING: write_string(alloc, (const string*)data); break;
+        default: write_primitive(alloc, data, m->type_size); break;
+    }
+}
+
+u8* meta_serialize(stack_alloc* alloc, const meta* m, const void* data) {
+    u8* begin = alloc->cursor;
+    write_value(alloc, m, data);
+    return begin;
+}
+
+typedef struct {
+    const u8* cursor;
+    const u8* end;
+} reader;
+
+static u8 read_bytes(reader* r, u8* data, uptr size) {
+    if (size > bytesize(r->cursor, r->end)) {
+        return 0;
+    }
+    __builtin_memcpy(data, r->cursor, size);
+    r->cursor += size;
+    return 1;
+}
+
+static u8 read_primitive(reader* r, u8* data, uptr size) {
+    if (size > bytesize(r->cursor, r->end)) {
+        return 0;
+    }
+    for (uptr i = 0; i < size; ++i) {
+        data[HOST_IS_LITTLE_ENDIAN ? i : size - 1 - i] = r->cursor[i];
+    }
+    r->cursor += size;
+    return 1;
+}
+
+static u8 read_value(stack_alloc* alloc, reader* r, const meta* m, u8* data);
+
+static u8 read_array(stack_alloc* alloc, reader* r, const meta* m, u8* data) {
+    const meta* element_meta = m->array_element_meta;
+    u64 count;
+    if (!read_primitive(r, (u8*)&count, sizeof(count))) {
+        return 0;
+    }
+    // A corrupt count is rejected before allocating: the input holds every element, and the
+    // elements, which can be larger in memory than serialized, fit the arena
+    const uptr remaining = bytesize(r->cursor, r->end);
+    const uptr minimum_element_size = meta_serialized_minimum(element_meta);
+    if (minimum_element_size && count > remaining / minimum_element_size) {
+        return 0;
+    }
+    // Element storage is aligned for any primitive, nested allocations follow it
+    const uptr alignment = (uptr)(-(uptr)alloc->cursor & (sizeof(u64) - 1));
+    const uptr available = bytesize(alloc->cursor, alloc->end);
+    if (alignment > available || (element_meta->type_size && count > (available - alignment) / element_meta->type_size)) {
+        return 0;
+    }
+
+    sa_alloc(alloc, alignment);
+    u8* begin = sa_alloc(alloc, (uptr)count * element_meta->type_size);
+    u8* end = alloc->cursor;
+    *(u8**)data = begin;
+    *(u8**)byteoffset(data, sizeof(void*)) = end;
+
+    if (meta_is_packed(element_meta)) {
+        return read_bytes(r, begin, bytesize(begin, end));
+    }
+    for (u8* element = begin; element < end; element += element_meta->type_size) {
+        if (!read_value(alloc, r, element_meta, element)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static u8 read_string(stack_alloc* alloc, reader* r, string* text) {
+    u64 size;
+    if (!read_primitive(r, (u8*)&size, sizeof(size)) || size > bytesize(r->cursor, r->end)) {
+        return 0;
+    }
+    text->begin = sa_alloc(alloc, (uptr)size);
+    text->end = alloc->cursor;
+    return read_bytes(r, (u8*)text->begin, (uptr)size);
+}
+
+static u8 read_struct(stack_alloc* alloc, reader* r, const meta* m, u8* data) {
+    uptr run_begin = 0;
+    uptr run_end = 0;
+    for (const field_descriptor* field = m->fields.begin; field < m->fields.end; ++field) {
+        const meta* field_meta = field->field_meta;
+        if (meta_is_packed(field_meta)) {
+            if (field->offset != run_end) {
+                if (!read_bytes(r, data + run_begin, run_end - run_begin)) {return 0;}
+                run_begin = field->offset;
+            }
+            run_end = field->offset + field_meta->type_size;
+            continue;
+        }
+        if (!read_bytes(r, data + run_begin, run_end - run_begin)) {return 0;}
+        run_begin = run_end = 0;
+        if (!read_value(alloc, r, field_meta, data + field->offset)) {return 0;}
+    }
+    return read_bytes(r, data + run_begin, run_end - run_begin);
+}
+
+static u8 read_value(stack_alloc* alloc, reader* r, const meta* m, u8* data) {
+    switch (m->pt) {
+        case PT_NONE: return read_struct(alloc, r, m, data);
+        case PT_ARRAY: return read_array(alloc, r, m, data);
+        case PT_STRING: return read_string(alloc, r, (string*)data);
+        default: return read_primitive(r, data, m->type_size);
+    }
+}
+
+const u8* meta_deserialize(stack_alloc* alloc, const meta* m, const u8* begin, const u8* end, void* data) {
+    debug_assert(begin <= end);
+    void* allocations = alloc->cursor;
+    reader r = {begin, end};
+    if (!read_value(alloc, &r, m, data)) {
+        sa_free(alloc, allocations);
+        return 0;
+    }
+    return r.cursor;
+}
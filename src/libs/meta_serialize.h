@@ -0,0 +1,32 @@
+#ifndef META_SERIALIZE_H
+#define META_SERIALIZE_H
+
+#include "primitive.h"
+#include "stack_alloc.h"
+#include "meta.h"
+
+// Binary serialization of meta described values
+//
+// Format, little-endian:
+//   primitive: type_size bytes
+//   struct:    the fields in declaration order, padding is not written
+//   array:     element count as a u64, then the elements
+//   string:    byte count as a u64, then the bytes
+//
+// Struct fields that are laid out back to back in memory and contain neither arrays nor padding
+// are copied with a single memcpy, as are whole arrays of such elements.
+//
+// Example usage:
+//   u8* begin = meta_serialize(alloc, &complex_meta, &value);
+//   u8* end = alloc->cursor;
+//   complex_t copy;
+//   meta_deserialize(alloc, &complex_meta, begin, end, &copy);
+
+// Write the value at data, returns the beginning of the bytes (end is alloc->cursor)
+u8* meta_serialize(stack_alloc* alloc, const meta* m, const void* data);
+
+// Read a value written by meta_serialize into data. Array elements and string bytes are allocated from alloc.
+// Returns the end of the bytes read, 0 if [begin, end) is too short (nothing stays allocated then).
+const u8* meta_deserialize(stack_alloc* alloc, const meta* m, const u8* begin, const u8* end, void* data);
+
+#endif /* META_SERIALIZE_H */
@@ -7,6 +7,10 @@
 #include <netdb.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <poll.h>
+
+// Declared by <sys/socket.h> with _GNU_SOURCE only
+extern int accept4(int fd, struct sockaddr* addr, socklen_t* addrlen, int flags);
 
 static size_t slice_len(u8_slice s) {
     return bytesize(s.begin, s.end);
@@ -64,7 +68,7 @@ tcp* tcp_init_client(u8_slice host, u8_slice port, stack_alloc* alloc) {
     return connection;
 }
 
-tcp* tcp_init_server(u8_slice host, u8_slice port, stack_alloc* alloc) {
+static tcp* tcp_init_server_options(u8_slice host, u8_slice port, u8 reuse_port, stack_alloc* alloc) {
     struct addrinfo hints;
     for (u8* c = (u8*)&hints; c < (u8*)(&hints + 1); ++c) {*c = 0;}
     hints.ai_socktype = SOCK_STREAM;
@@ -102,6 +106,10 @@ tcp* tcp_init_server(u8_slice host, u8_slice port, stack_alloc* alloc) {
 
         int opt = 1;
         setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+        if (reuse_port && setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)) != 0) {
+            close(fd);
+            continue;
+        }
 
         if (bind(fd, rp->ai_addr, rp->ai_addrlen) != 0) {
             close(fd);
@@ -127,6 +135,14 @@ tcp* tcp_init_server(u8_slice host, u8_slice port, stack_alloc* alloc) {
     return connection;
 }
 
+tcp* tcp_init_server(u8_slice host, u8_slice port, stack_alloc* alloc) {
+    return tcp_init_server_options(host, port, 0, alloc);
+}
+
+tcp* tcp_init_server_reuseport(u8_slice host, u8_slice port, stack_alloc* alloc) {
+    return tcp_init_server_options(host, port, 1, alloc);
+}
+
 u8 tcp_connect(tcp* connection) {
     debug_assert(connection != NULL);
     debug_assert(connection->fd != file_invalid());
@@ -153,6 +169,20 @@ tcp* tcp_accept(tcp* server, stack_alloc* alloc) {
     return connection;
 }
 
+u8 tcp_accept_nonblocking(tcp* server, tcp* connection) {
+    debug_assert(server->fd != file_invalid());
+
+    int client_fd = accept4((int)server->fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (client_fd < 0) {
+        return 0;
+    }
+
+    connection->fd = (file_t)client_fd;
+    connection->res = NULL;
+    connection->chosen = NULL;
+    return 1;
+}
+
 u8 tcp_set_nonblocking(tcp* connection, u8 nonblocking) {
     debug_assert(connection->fd != file_invalid());
 
@@ -170,30 +200,21 @@ u8 tcp_set_nonblocking(tcp* connection, u8 nonblocking) {
     return 1;
 }
 
-u8 tcp_is_writable(tcp* connection) {
-    fd_set writefds;
-    struct timeval timeout = {0, 0};
-
-    FD_ZERO(&writefds);
-    FD_SET(connection->fd, &writefds);
-
-    int result = select(connection->fd + 1, NULL, &writefds, NULL, &timeout);
+/* poll has no limit on the descriptor value, unlike select and FD_SETSIZE */
+static u8 tcp_poll_now(tcp* connection, short events) {
+    struct pollfd pfd = {.fd = (int)connection->fd, .events = events};
+    int result = poll(&pfd, 1, 0);
     if (result < 0) return 0;
 
-    return (result > 0) && FD_ISSET(connection->fd, &writefds);
+    return (result > 0) && (pfd.revents & events);
 }
 
-u8 tcp_is_readable(tcp* connection) {
-    fd_set readfds;
-    struct timeval timeout = {0, 0};
-
-    FD_ZERO(&readfds);
-    FD_SET(connection->fd, &readfds);
-
-    int result = select(connection->fd + 1, &readfds, NULL, NULL, &timeout);
-    if (result < 0) return 0;
+u8 tcp_is_writable(tcp* connection) {
+    return tcp_poll_now(connection, POLLOUT);
+}
 
-    return (result > 0) && FD_ISSET(connection->fd, &readfds);
+u8 tcp_is_readable(tcp* connection) {
+    return tcp_poll_now(connection, POLLIN);
 }
 
 file_t tcp_get_interal(tcp* connection) {
@@ -14,12 +14,20 @@ tcp* tcp_init_client(u8_slice host, u8_slice port, stack_alloc* alloc);
 /* Create a server tcp handle (resolve, bind, listen). */
 tcp* tcp_init_server(u8_slice host, u8_slice port, stack_alloc* alloc);
 
+/* tcp_init_server with SO_REUSEPORT: the kernel spreads the connections to the address over
+   all the sockets bound to it this way, each one can be accepted from its own thread. */
+tcp* tcp_init_server_reuseport(u8_slice host, u8_slice port, stack_alloc* alloc);
+
 /* Connect a client socket (returns 1 on success). For server returns 1. */
 u8 tcp_connect(tcp* connection);
 
 /* Accept an incoming connection on a listening server socket. */
 tcp* tcp_accept(tcp* server, stack_alloc* alloc);
 
+/* Accept into connection with accept4, the socket is non-blocking and close-on-exec.
+   Returns 0 when no connection is pending on a non-blocking server, or on error. */
+u8 tcp_accept_nonblocking(tcp* server, tcp* connection);
+
 /* Set or clear non-blocking mode (returns 1 on success). */
 u8 tcp_set_nonblocking(tcp* connection, u8 nonblocking);
 
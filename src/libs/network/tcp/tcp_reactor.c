@@ -0,0 +1,244 @@
+#include "tcp_reactor.h"
+#include "tcp_connection_type.h"
+#include "system_time.h"
+#include "assert.h"
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+typedef struct {
+    tcp* connection;                   /* 0 when free */
+    tcp_reactor_callback callback;
+    void* context;
+    u32 generation;                    /* Bumped on remove, the events of a removed handle are dropped */
+    u32 next_free;                     /* Index + 1 of the next free slot, 0 for the last */
+} reactor_slot;
+
+typedef struct {
+    u64 deadline_ms;
+    u32 id;
+    tcp_reactor_timer_callback callback;
+    void* context;
+} reactor_timer;
+
+struct tcp_reactor {
+    int epoll_fd;
+    u8 stopped;
+    reactor_slot* slots;
+    u32 slot_count;
+    u32 free_slot;                     /* Index + 1 of the first free slot, 0 when full */
+    u32 registered;
+    reactor_timer* timers;             /* Binary min heap on deadline_ms */
+    u32 timer_count;
+    u32 max_timers;
+    u32 last_timer_id;
+};
+
+static u64 reactor_now_ms(void) {
+    return sys_time_monotonic_ns() / 1000000;
+}
+
+static u32 reactor_epoll_events(u32 interest) {
+    u32 events = EPOLLET;
+    if (interest & TCP_REACTOR_READ) events |= EPOLLIN | EPOLLRDHUP;
+    if (interest & TCP_REACTOR_WRITE) events |= EPOLLOUT;
+    return events;
+}
+
+tcp_reactor* tcp_reactor_open(stack_alloc* alloc, u32 max_connections, u32 max_timers) {
+    const int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        return 0;
+    }
+
+    tcp_reactor* reactor = sa_alloc(alloc, sizeof(*reactor));
+    reactor->epoll_fd = epoll_fd;
+    reactor->stopped = 0;
+    reactor->slots = sa_alloc(alloc, sizeof(*reactor->slots) * max_connections);
+    reactor->slot_count = max_connections;
+    for (u32 i = 0; i < max_connections; ++i) {
+        reactor->slots[i] = (reactor_slot){.next_free = i + 1 < max_connections ? i + 2 : 0};
+    }
+    reactor->free_slot = max_connections ? 1 : 0;
+    reactor->registered = 0;
+    reactor->timers = sa_alloc(alloc, sizeof(*reactor->timers) * max_timers);
+    reactor->timer_count = 0;
+    reactor->max_timers = max_timers;
+    reactor->last_timer_id = 0;
+    return reactor;
+}
+
+void tcp_reactor_close(tcp_reactor* reactor) {
+    close(reactor->epoll_fd);
+    reactor->epoll_fd = -1;
+}
+
+u32 tcp_reactor_add(tcp_reactor* reactor, tcp* connection, u32 interest, tcp_reactor_callback callback, void* context) {
+    debug_assert(connection->fd != file_invalid());
+    if (!reactor->free_slot) {
+        return 0;
+    }
+    const u32 index = reactor->free_slot - 1;
+    reactor_slot* slot = &reactor->slots[index];
+
+    struct epoll_event event;
+    event.events = reactor_epoll_events(interest);
+    event.data.u64 = (u64)slot->generation << 32 | index;
+    if (epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, (int)connection->fd, &event) != 0) {
+        return 0;
+    }
+
+    reactor->free_slot = slot->next_free;
+    slot->connection = connection;
+    slot->callback = callback;
+    slot->context = context;
+    reactor->registered += 1;
+    return index + 1;
+}
+
+u8 tcp_reactor_modify(tcp_reactor* reactor, u32 id, u32 interest) {
+    debug_assert(id > 0 && id <= reactor->slot_count);
+    reactor_slot* slot = &reactor->slots[id - 1];
+    debug_assert(slot->connection != 0);
+
+    struct epoll_event event;
+    event.events = reactor_epoll_events(interest);
+    event.data.u64 = (u64)slot->generation << 32 | (id - 1);
+    return epoll_ctl(reactor->epoll_fd, EPOLL_CTL_MOD, (int)slot->connection->fd, &event) == 0;
+}
+
+void tcp_reactor_remove(tcp_reactor* reactor, u32 id) {
+    debug_assert(id > 0 && id <= reactor->slot_count);
+    reactor_slot* slot = &reactor->slots[id - 1];
+    debug_assert(slot->connection != 0);
+
+    struct epoll_event unused_event = {0};
+    epoll_ctl(reactor->epoll_fd, EPOLL_CTL_DEL, (int)slot->connection->fd, &unused_event);
+    slot->connection = 0;
+    slot->generation += 1;
+    slot->next_free = reactor->free_slot;
+    reactor->free_slot = id;
+    reactor->registered -= 1;
+}
+
+static void reactor_timer_swap(reactor_timer* a, reactor_timer* b) {
+    const reactor_timer t = *a;
+    *a = *b;
+    *b = t;
+}
+
+static void reactor_timer_sift_up(tcp_reactor* reactor, u32 i) {
+    reactor_timer* heap = reactor->timers;
+    while (i > 0 && heap[(i - 1) / 2].deadline_ms > heap[i].deadline_ms) {
+        reactor_timer_swap(&heap[(i - 1) / 2], &heap[i]);
+        i = (i - 1) / 2;
+    }
+}
+
+static void reactor_timer_sift_down(tcp_reactor* reactor, u32 i) {
+    reactor_timer* heap = reactor->timers;
+    while (1) {
+        u32 smallest = i;
+        const u32 left = 2 * i + 1;
+        const u32 right = left + 1;
+        if (left < reactor->timer_count && heap[left].deadline_ms < heap[smallest].deadline_ms) smallest = left;
+        if (right < reactor->timer_count && heap[right].deadline_ms < heap[smallest].deadline_ms) smallest = right;
+        if (smallest == i) {
+            return;
+        }
+        reactor_timer_swap(&heap[i], &heap[smallest]);
+        i = smallest;
+    }
+}
+
+static void reactor_timer_remove_at(tcp_reactor* reactor, u32 i) {
+    reactor->timer_count -= 1;
+    if (i == reactor->timer_count) {
+        return;
+    }
+    reactor->timers[i] = reactor->timers[reactor->timer_count];
+    reactor_timer_sift_down(reactor, i);
+    reactor_timer_sift_up(reactor, i);
+}
+
+u32 tcp_reactor_timer(tcp_reactor* reactor, u64 delay_ms, tcp_reactor_timer_callback callback, void* context) {
+    if (reactor->timer_count == reactor->max_timers) {
+        return 0;
+    }
+    reactor->last_timer_id = reactor->last_timer_id + 1 ? reactor->last_timer_id + 1 : 1;
+    reactor_timer* timer = &reactor->timers[reactor->timer_count];
+    timer->deadline_ms = reactor_now_ms() + delay_ms;
+    timer->id = reactor->last_timer_id;
+    timer->callback = callback;
+    timer->context = context;
+    reactor->timer_count += 1;
+    reactor_timer_sift_up(reactor, reactor->timer_count - 1);
+    return reactor->last_timer_id;
+}
+
+void tcp_reactor_cancel_timer(tcp_reactor* reactor, u32 id) {
+    for (u32 i = 0; i < reactor->timer_count; ++i) {
+        if (reactor->timers[i].id == id) {
+            reactor_timer_remove_at(reactor, i);
+            return;
+        }
+    }
+}
+
+u32 tcp_reactor_run_once(tcp_reactor* reactor, i32 timeout_ms) {
+    int wait_ms = timeout_ms < 0 ? -1 : timeout_ms;
+    if (reactor->timer_count) {
+        const u64 now_ms = reactor_now_ms();
+        const u64 next_ms = reactor->timers[0].deadline_ms;
+        const u64 timer_ms = next_ms > now_ms ? next_ms - now_ms : 0;
+        if (wait_ms < 0 || timer_ms < (u64)wait_ms) {
+            wait_ms = timer_ms < 0x7fffffff ? (int)timer_ms : 0x7fffffff;
+        }
+    }
+
+    u32 ran = 0;
+    struct epoll_event events[TCP_REACTOR_MAX_EVENTS];
+    const int count = epoll_wait(reactor->epoll_fd, events, TCP_REACTOR_MAX_EVENTS, wait_ms);
+    for (int i = 0; i < count; ++i) {
+        const u32 index = (u32)events[i].data.u64;
+        reactor_slot* slot = &reactor->slots[index];
+        if (!slot->connection || slot->generation != (u32)(events[i].data.u64 >> 32)) {
+            /* Removed by an earlier callback of this iteration */
+            continue;
+        }
+        tcp_reactor_event event;
+        event.id = index + 1;
+        event.events = 0;
+        if (events[i].events & EPOLLIN) event.events |= TCP_REACTOR_READ;
+        if (events[i].events & EPOLLOUT) event.events |= TCP_REACTOR_WRITE;
+        if (events[i].events & (EPOLLHUP | EPOLLERR | EPOLLRDHUP)) event.events |= TCP_REACTOR_HANGUP;
+        event.connection = slot->connection;
+        event.context = slot->context;
+        slot->callback(reactor, &event);
+        ran += 1;
+    }
+
+    /* Timers started by these callbacks wait for the next iteration */
+    const u64 now_ms = reactor_now_ms();
+    for (u32 pending = reactor->timer_count; pending > 0 && reactor->timer_count > 0; --pending) {
+        if (reactor->timers[0].deadline_ms > now_ms) {
+            break;
+        }
+        const reactor_timer timer = reactor->timers[0];
+        reactor_timer_remove_at(reactor, 0);
+        timer.callback(reactor, timer.context);
+        ran += 1;
+    }
+    return ran;
+}
+
+void tcp_reactor_run(tcp_reactor* reactor) {
+    reactor->stopped = 0;
+    while (!reactor->stopped && (reactor->registered || reactor->timer_count)) {
+        tcp_reactor_run_once(reactor, -1);
+    }
+}
+
+void tcp_reactor_stop(tcp_reactor* reactor) {
+    reactor->stopped = 1;
+}
@@ -0,0 +1,71 @@
+#ifndef TCP_REACTOR_H
+#define TCP_REACTOR_H
+
+#include "tcp_connection.h"
+
+/* Event loop over many tcp handles on one thread (epoll).
+
+   Handles are registered with a read and/or write interest and a callback. Notifications are
+   edge triggered: a callback is called once each time a handle becomes readable or writable,
+   so it reads (or writes) until the call would block, with handles in non-blocking mode.
+   Registrations live in a table sized at open, the cost of a loop iteration depends on the
+   number of ready handles only.
+
+   Timers run their callback once, after their delay, from the same loop.
+
+   Example usage:
+     tcp_reactor* reactor = tcp_reactor_open(alloc, 10000, 16);
+     tcp_set_nonblocking(server, 1);
+     tcp_reactor_add(reactor, server, TCP_REACTOR_READ, on_accept, &state);
+     tcp_reactor_run(reactor);
+     tcp_reactor_close(reactor);
+     sa_free(alloc, reactor);
+*/
+
+typedef struct tcp_reactor tcp_reactor;
+
+typedef enum {
+    TCP_REACTOR_READ = 1,
+    TCP_REACTOR_WRITE = 2,
+    TCP_REACTOR_HANGUP = 4            /* Peer closed or error, only in tcp_reactor_event.events */
+} tcp_reactor_interest;
+
+/* Events read by one epoll_wait */
+#define TCP_REACTOR_MAX_EVENTS 256
+
+typedef struct {
+    u32 id;
+    u32 events;                        /* tcp_reactor_interest bits */
+    tcp* connection;
+    void* context;
+} tcp_reactor_event;
+
+typedef void (*tcp_reactor_callback)(tcp_reactor* reactor, const tcp_reactor_event* event);
+typedef void (*tcp_reactor_timer_callback)(tcp_reactor* reactor, void* context);
+
+/* Reactor for up to max_connections handles and max_timers pending timers, 0 on failure. */
+tcp_reactor* tcp_reactor_open(stack_alloc* alloc, u32 max_connections, u32 max_timers);
+/* Close the epoll descriptor, the registered handles stay open. */
+void tcp_reactor_close(tcp_reactor* reactor);
+
+/* Register connection, returns its id or 0 when the table is full or epoll refused it. */
+u32 tcp_reactor_add(tcp_reactor* reactor, tcp* connection, u32 interest, tcp_reactor_callback callback, void* context);
+/* Change the interest of a registered handle (returns 1 on success). */
+u8 tcp_reactor_modify(tcp_reactor* reactor, u32 id, u32 interest);
+/* Unregister, pending events of the handle are dropped. Call it before closing the handle. */
+void tcp_reactor_remove(tcp_reactor* reactor, u32 id);
+
+/* Run callback once after delay_ms. Returns the timer id, 0 when max_timers are pending. */
+u32 tcp_reactor_timer(tcp_reactor* reactor, u64 delay_ms, tcp_reactor_timer_callback callback, void* context);
+/* Cancel a pending timer, linear in the number of pending timers. */
+void tcp_reactor_cancel_timer(tcp_reactor* reactor, u32 id);
+
+/* Wait up to timeout_ms (no limit if negative, shortened to the next timer) and run the
+   callbacks of the ready handles and expired timers. Returns the number of callbacks run. */
+u32 tcp_reactor_run_once(tcp_reactor* reactor, i32 timeout_ms);
+/* Run until no handle is registered and no timer is pending, or until tcp_reactor_stop. */
+void tcp_reactor_run(tcp_reactor* reactor);
+/* Make tcp_reactor_run return after the current iteration. */
+void tcp_reactor_stop(tcp_reactor* reactor);
+
+#endif /* TCP_REACTOR_H */
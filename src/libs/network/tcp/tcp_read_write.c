@@ -3,6 +3,7 @@
 
 #include <sys/socket.h>
 #include <unistd.h>
+#include <sys/sendfile.h>
 
 tcp_r_result tcp_read_once(tcp* connection, stack_alloc* alloc, uptr max_len) {
     tcp_r_result res;
@@ -54,3 +55,28 @@ tcp_w_result tcp_write_once(tcp* connection, u8_slice data) {
     }
     return res;
 }
+
+tcp_w_result tcp_send_file(tcp* connection, file_t file, uptr offset, uptr size) {
+    tcp_w_result res;
+    res.status = TCP_RW_ERR;
+    res.bytes = 0;
+
+    if (connection->fd == file_invalid()) return res;
+
+    if (size == 0) {
+        res.status = TCP_RW_OK;
+        return res;
+    }
+
+    off_t file_offset = (off_t)offset;
+    ssize_t rc = sendfile((int)connection->fd, (int)file, &file_offset, (size_t)size);
+    if (rc < 0) {
+        res.status = TCP_RW_ERR;
+    } else if (rc == 0) {
+        res.status = TCP_RW_EOF;
+    } else {
+        res.status = TCP_RW_OK;
+        res.bytes = (uptr)rc;
+    }
+    return res;
+}
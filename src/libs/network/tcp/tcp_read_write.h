@@ -6,7 +6,8 @@
 typedef enum {
     TCP_RW_OK = 0,
     TCP_RW_EOF = 1,
-    TCP_RW_ERR = 2
+    TCP_RW_ERR = 2,
+    TCP_RW_AGAIN = 3        /* Would block, non-blocking connections (tcp_stream only) */
 } tcp_rw_status;
 
 typedef struct {
@@ -24,4 +25,8 @@ tcp_r_result tcp_read_once(tcp* connection, stack_alloc* alloc, uptr max_len);
 /* Write data once. res.bytes holds bytes written on success. */
 tcp_w_result tcp_write_once(tcp* connection, u8_slice data);
 
+/* Send [offset, offset + size) of file once, without copying it through user memory.
+   res.bytes holds bytes sent on success, TCP_RW_EOF if the file ends before offset. */
+tcp_w_result tcp_send_file(tcp* connection, file_t file, uptr offset, uptr size);
+
 #endif /* TCP_READ_WRITE_H */
@@ -0,0 +1,221 @@
+#include "tcp_server.h"
+#include "tcp_connection_type.h"
+#include "mem.h"
+#include "assert.h"
+
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+/* Delay before accepting again when the process ran out of memory or descriptors */
+#define TCP_SERVER_ACCEPT_RETRY_MS 100
+
+typedef struct {
+    tcp_server_worker worker;          /* First, the callbacks get a pointer to it */
+    stack_alloc alloc;
+    void* memory;
+    uptr memory_size;
+    tcp* listener;
+    tcp wake;                          /* eventfd written by tcp_server_stop */
+    int reserve_fd;                    /* Closed to make room for a connection to refuse */
+    u8 retry_pending;                  /* An accept retry timer is pending */
+    tcp* connections;
+    tcp** free;                        /* Stack of the connections not in use */
+    u32 free_count;
+    u32 max_connections;
+    tcp_server_accept_callback on_accept;
+    pthread_t thread;
+    u8 started;
+} server_worker;
+
+struct tcp_server {
+    server_worker* workers;
+    u32 worker_count;
+};
+
+static void server_accept_backlog(server_worker* w);
+
+static void server_accept_retry(tcp_reactor* reactor, void* context) {
+    unused(reactor);
+    server_worker* w = context;
+    w->retry_pending = 0;
+    server_accept_backlog(w);
+}
+
+/* Out of descriptors, the reserve one makes room to accept the connection and close it.
+   Returns 0 if it could not. */
+static u8 server_refuse_with_reserve(server_worker* w) {
+    if (w->reserve_fd < 0) {
+        return 0;
+    }
+    close(w->reserve_fd);
+    tcp refused;
+    const u8 accepted = tcp_accept_nonblocking(w->listener, &refused);
+    const int error = errno;
+    if (accepted) {
+        tcp_close(&refused);
+    }
+    w->reserve_fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    errno = error;
+    return accepted;
+}
+
+/* Edge triggered, accept until the backlog is empty. No event comes for the connections left
+   in it, so when the process is out of resources the backlog is drained again by a timer. */
+static void server_accept_backlog(server_worker* w) {
+    while (1) {
+        tcp overflow;
+        tcp* connection = w->free_count ? w->free[w->free_count - 1] : &overflow;
+        if (!tcp_accept_nonblocking(w->listener, connection)) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            if ((errno == EMFILE || errno == ENFILE) && server_refuse_with_reserve(w)) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK && !w->retry_pending) {
+                w->retry_pending = tcp_reactor_timer(w->worker.reactor, TCP_SERVER_ACCEPT_RETRY_MS, server_accept_retry, w) != 0;
+            }
+            return;
+        }
+        if (connection == &overflow) {
+            tcp_close(&overflow);
+            continue;
+        }
+        w->free_count -= 1;
+        w->on_accept(&w->worker, connection);
+    }
+}
+
+static void server_accept(tcp_reactor* reactor, const tcp_reactor_event* event) {
+    unused(reactor);
+    server_accept_backlog(event->context);
+}
+
+static void server_wake(tcp_reactor* reactor, const tcp_reactor_event* event) {
+    unused(event);
+    tcp_reactor_stop(reactor);
+}
+
+static void* server_worker_main(void* argument) {
+    server_worker* w = argument;
+    tcp_reactor_run(w->worker.reactor);
+    return 0;
+}
+
+static void server_worker_close(server_worker* w) {
+    if (w->connections) {
+        for (tcp* connection = w->connections; connection < w->connections + w->max_connections; ++connection) {
+            tcp_close(connection);
+        }
+    }
+    if (w->worker.reactor) {
+        tcp_reactor_close(w->worker.reactor);
+    }
+    tcp_close(&w->wake);
+    if (w->reserve_fd >= 0) {
+        close(w->reserve_fd);
+    }
+    tcp_close(w->listener);
+    sa_free(&w->alloc, w->memory);
+    sa_deinit(&w->alloc);
+    mem_unmap(w->memory, w->memory_size);
+}
+
+static u8 server_worker_open(server_worker* w, u32 index, u8_slice host, u8_slice port, const tcp_server_config* config) {
+    *w = (server_worker){0};
+    w->memory_size = config->arena_size;
+    w->memory = mem_map(w->memory_size);
+    sa_init(&w->alloc, w->memory, byteoffset(w->memory, w->memory_size));
+    w->wake.fd = file_invalid();
+    w->reserve_fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+
+    w->listener = tcp_init_server_reuseport(host, port, &w->alloc);
+    if (!w->listener || w->listener->fd == file_invalid() || !tcp_set_nonblocking(w->listener, 1)) {
+        server_worker_close(w);
+        return 0;
+    }
+
+    w->max_connections = config->max_connections;
+    w->connections = sa_alloc(&w->alloc, sizeof(*w->connections) * w->max_connections);
+    w->free = sa_alloc(&w->alloc, sizeof(*w->free) * w->max_connections);
+    for (u32 i = 0; i < w->max_connections; ++i) {
+        w->connections[i] = (tcp){file_invalid(), NULL, NULL};
+        w->free[i] = &w->connections[w->max_connections - 1 - i];
+    }
+    w->free_count = w->max_connections;
+
+    w->worker.index = index;
+    w->worker.alloc = &w->alloc;
+    w->worker.context = config->context;
+    w->on_accept = config->on_accept;
+    w->worker.reactor = tcp_reactor_open(&w->alloc, w->max_connections + 2, 1);
+    const int wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (!w->worker.reactor || wake_fd < 0) {
+        server_worker_close(w);
+        return 0;
+    }
+    w->wake.fd = (file_t)wake_fd;
+    if (!tcp_reactor_add(w->worker.reactor, w->listener, TCP_REACTOR_READ, server_accept, w)
+        || !tcp_reactor_add(w->worker.reactor, &w->wake, TCP_REACTOR_READ, server_wake, w)) {
+        server_worker_close(w);
+        return 0;
+    }
+    return 1;
+}
+
+tcp_server* tcp_server_start(u8_slice host, u8_slice port, tcp_server_config config, stack_alloc* alloc) {
+    u32 count = config.worker_count;
+    if (!count) {
+        const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        count = cores > 0 ? (u32)cores : 1;
+    }
+
+    tcp_server* server = sa_alloc(alloc, sizeof(*server));
+    server->workers = sa_alloc(alloc, sizeof(*server->workers) * count);
+    server->worker_count = 0;
+    /* Every listener is bound before a worker runs, so a busy port fails here */
+    for (u32 i = 0; i < count; ++i) {
+        if (!server_worker_open(&server->workers[i], i, host, port, &config)) {
+            tcp_server_stop(server);
+            sa_free(alloc, server);
+            return 0;
+        }
+        server->worker_count += 1;
+    }
+    /* A listener without its thread would still be given connections */
+    for (server_worker* w = server->workers; w < server->workers + count; ++w) {
+        w->started = pthread_create(&w->thread, 0, server_worker_main, w) == 0;
+        if (!w->started) {
+            tcp_server_stop(server);
+            sa_free(alloc, server);
+            return 0;
+        }
+    }
+    return server;
+}
+
+u32 tcp_server_worker_count(const tcp_server* server) {
+    return server->worker_count;
+}
+
+void tcp_server_release(tcp_server_worker* worker, tcp* connection) {
+    server_worker* w = (server_worker*)worker;
+    debug_assert(connection >= w->connections && connection < w->connections + w->max_connections);
+    tcp_close(connection);
+    w->free[w->free_count++] = connection;
+}
+
+void tcp_server_stop(tcp_server* server) {
+    for (server_worker* w = server->workers; w < server->workers + server->worker_count; ++w) {
+        if (w->started) {
+            const u64 one = 1;
+            write((int)w->wake.fd, &one, sizeof(one));
+            pthread_join(w->thread, 0);
+        }
+        server_worker_close(w);
+    }
+    server->worker_count = 0;
+}
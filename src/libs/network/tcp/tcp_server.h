@@ -0,0 +1,58 @@
+#ifndef TCP_SERVER_H
+#define TCP_SERVER_H
+
+#include "tcp_connection.h"
+#include "tcp_reactor.h"
+
+/* Multi-threaded tcp server, one worker thread per core.
+
+   Each worker owns a SO_REUSEPORT listener bound to the same address, a tcp_reactor and a
+   stack_alloc arena, nothing is shared between workers: the kernel balances the incoming
+   connections over the listeners and every connection is served by the thread that accepted
+   it. Connections are accepted with accept4, non-blocking and close-on-exec, into a pool of
+   max_connections handles per worker. When the pool is empty new connections are closed, as
+   when the process runs out of descriptors (a reserve descriptor makes room to accept them).
+   Accepting is retried after a delay when it fails for lack of memory.
+
+   on_accept runs on the worker thread, it usually registers the connection with the reactor
+   of the worker. A connection is handed back with tcp_server_release once it is done.
+
+   Example usage:
+     tcp_server_config config = {0, 1024, 1024 * 1024, on_accept, &state};
+     tcp_server* server = tcp_server_start(host, port, config, alloc);
+     ...
+     tcp_server_stop(server);
+     sa_free(alloc, server);
+*/
+
+typedef struct {
+    u32 index;
+    tcp_reactor* reactor;
+    stack_alloc* alloc;                /* Arena of the worker, only used from its thread */
+    void* context;                     /* tcp_server_config.context */
+} tcp_server_worker;
+
+typedef void (*tcp_server_accept_callback)(tcp_server_worker* worker, tcp* connection);
+
+typedef struct {
+    u32 worker_count;                  /* 0 for one per online core */
+    u32 max_connections;               /* Open connections of each worker */
+    uptr arena_size;                   /* Bytes of the arena of each worker */
+    tcp_server_accept_callback on_accept;
+    void* context;
+} tcp_server_config;
+
+typedef struct tcp_server tcp_server;
+
+/* Bind a listener per worker and start the workers. Returns 0 if a listener could not be
+   bound or a worker thread could not start, port must be a fixed port for the listeners to
+   share it. */
+tcp_server* tcp_server_start(u8_slice host, u8_slice port, tcp_server_config config, stack_alloc* alloc);
+u32 tcp_server_worker_count(const tcp_server* server);
+/* Close connection and return it to the pool, from the thread of its worker. The caller
+   removes it from the reactor first. */
+void tcp_server_release(tcp_server_worker* worker, tcp* connection);
+/* Stop and join the workers, close the listeners and the connections not released. */
+void tcp_server_stop(tcp_server* server);
+
+#endif /* TCP_SERVER_H */
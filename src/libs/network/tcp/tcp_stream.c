@@ -0,0 +1,174 @@
+#include "tcp_stream.h"
+#include "tcp_connection_type.h"
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <errno.h>
+
+struct tcp_stream {
+    tcp* connection;
+    u8* in;
+    u8* in_end;
+    u8* read;                          /* Unread input [read, filled) */
+    u8* filled;
+    u8* scanned;                       /* read_until found no delimiter in [read, scanned) */
+    u8* out;
+    u8* out_end;
+    u8* sent;                          /* Buffered output [sent, buffered) */
+    u8* buffered;
+};
+
+tcp_stream* tcp_stream_open(tcp* connection, uptr input_size, uptr output_size, stack_alloc* alloc) {
+    tcp_stream* stream = sa_alloc(alloc, sizeof(*stream));
+    stream->connection = connection;
+    stream->in = sa_alloc(alloc, input_size);
+    stream->in_end = stream->in + input_size;
+    stream->read = stream->in;
+    stream->filled = stream->in;
+    stream->scanned = stream->in;
+    stream->out = sa_alloc(alloc, output_size);
+    stream->out_end = stream->out + output_size;
+    stream->sent = stream->out;
+    stream->buffered = stream->out;
+    return stream;
+}
+
+static tcp_rw_status stream_errno_status(void) {
+    return errno == EAGAIN || errno == EWOULDBLOCK ? TCP_RW_AGAIN : TCP_RW_ERR;
+}
+
+/* Drop the consumed input, then receive what fits after the unread bytes */
+static tcp_rw_status stream_fill(tcp_stream* stream) {
+    if (stream->read != stream->in) {
+        const uptr unread = bytesize(stream->read, stream->filled);
+        const uptr scanned = bytesize(stream->read, stream->scanned);
+        __builtin_memmove(stream->in, stream->read, unread);
+        stream->read = stream->in;
+        stream->filled = stream->in + unread;
+        stream->scanned = stream->in + scanned;
+    }
+    if (stream->filled == stream->in_end) {
+        return TCP_RW_ERR;
+    }
+
+    while (1) {
+        ssize_t rc = recv((int)stream->connection->fd, stream->filled, bytesize(stream->filled, stream->in_end), 0);
+        if (rc > 0) {
+            stream->filled += rc;
+            return TCP_RW_OK;
+        }
+        if (rc == 0) {
+            return TCP_RW_EOF;
+        }
+        if (errno != EINTR) {
+            return stream_errno_status();
+        }
+    }
+}
+
+tcp_rw_status tcp_stream_read_until(tcp_stream* stream, u8 delimiter, u8_slice* out) {
+    while (1) {
+        /* Only the bytes received since the last call are searched */
+        u8* found = __builtin_memchr(stream->scanned, delimiter, bytesize(stream->scanned, stream->filled));
+        if (found) {
+            out->begin = stream->read;
+            out->end = found + 1;
+            stream->read = found + 1;
+            stream->scanned = stream->read;
+            return TCP_RW_OK;
+        }
+        stream->scanned = stream->filled;
+        const tcp_rw_status status = stream_fill(stream);
+        if (status != TCP_RW_OK) {
+            return status;
+        }
+    }
+}
+
+tcp_rw_status tcp_stream_read_exact(tcp_stream* stream, uptr size, u8_slice* out) {
+    if (size > bytesize(stream->in, stream->in_end)) {
+        return TCP_RW_ERR;
+    }
+    while (bytesize(stream->read, stream->filled) < size) {
+        const tcp_rw_status status = stream_fill(stream);
+        if (status != TCP_RW_OK) {
+            return status;
+        }
+    }
+    out->begin = stream->read;
+    out->end = stream->read + size;
+    stream->read += size;
+    if (stream->scanned < stream->read) {
+        stream->scanned = stream->read;
+    }
+    return TCP_RW_OK;
+}
+
+/* Copy to the output buffer if it fits, moving the pending bytes to its front if needed */
+static u8 stream_buffer(tcp_stream* stream, const u8* data, uptr size) {
+    if (size > bytesize(stream->buffered, stream->out_end)) {
+        const uptr pending = bytesize(stream->sent, stream->buffered);
+        if (size > bytesize(stream->out, stream->out_end) - pending) {
+            return 0;
+        }
+        __builtin_memmove(stream->out, stream->sent, pending);
+        stream->sent = stream->out;
+        stream->buffered = stream->out + pending;
+    }
+    __builtin_memcpy(stream->buffered, data, size);
+    stream->buffered += size;
+    return 1;
+}
+
+tcp_w_result tcp_stream_write(tcp_stream* stream, u8_slice data) {
+    tcp_w_result res;
+    res.status = TCP_RW_OK;
+    res.bytes = 0;
+
+    const uptr size = bytesize(data.begin, data.end);
+    while (!stream_buffer(stream, data.begin + res.bytes, size - res.bytes)) {
+        /* Too large for the buffer, sent after the buffered bytes in the same call */
+        const uptr pending = bytesize(stream->sent, stream->buffered);
+        struct iovec iov[2];
+        iov[0].iov_base = stream->sent;
+        iov[0].iov_len = pending;
+        iov[1].iov_base = data.begin + res.bytes;
+        iov[1].iov_len = size - res.bytes;
+        struct msghdr message = {0};
+        message.msg_iov = iov;
+        message.msg_iovlen = 2;
+        ssize_t rc = sendmsg((int)stream->connection->fd, &message, MSG_NOSIGNAL);
+        if (rc < 0) {
+            if (errno == EINTR) continue;
+            res.status = stream_errno_status();
+            return res;
+        }
+        const uptr from_buffer = (uptr)rc < pending ? (uptr)rc : pending;
+        stream->sent += from_buffer;
+        res.bytes += (uptr)rc - from_buffer;
+        if (stream->sent == stream->buffered) {
+            stream->sent = stream->out;
+            stream->buffered = stream->out;
+        }
+    }
+    res.bytes = size;
+    return res;
+}
+
+tcp_rw_status tcp_stream_flush(tcp_stream* stream) {
+    while (stream->sent < stream->buffered) {
+        ssize_t rc = send((int)stream->connection->fd, stream->sent, bytesize(stream->sent, stream->buffered), MSG_NOSIGNAL);
+        if (rc < 0) {
+            if (errno == EINTR) continue;
+            return stream_errno_status();
+        }
+        stream->sent += rc;
+    }
+    stream->sent = stream->out;
+    stream->buffered = stream->out;
+    return TCP_RW_OK;
+}
+
+uptr tcp_stream_output_pending(const tcp_stream* stream) {
+    return bytesize(stream->sent, stream->buffered);
+}
@@ -0,0 +1,47 @@
+#ifndef TCP_STREAM_H
+#define TCP_STREAM_H
+
+#include "tcp_connection.h"
+#include "tcp_read_write.h"
+
+/* Buffered reads and writes on a tcp connection.
+
+   Reads fill an input buffer with as much as the socket has, framing helpers then return
+   slices into it without copying: a slice stays valid until the next read call on the stream.
+   Consumed bytes are dropped by moving the unread tail to the front of the buffer, so a
+   message is always contiguous; a message longer than the input buffer is an error.
+
+   Small writes are copied to an output buffer and sent together by tcp_stream_flush. A write
+   that does not fit is sent right away with the buffered bytes in the same sendmsg call, and
+   partial sends are resumed. Both work on blocking and non-blocking connections, where
+   TCP_RW_AGAIN tells the call would block.
+
+   Example usage:
+     tcp_stream* stream = tcp_stream_open(connection, 4096, 4096, alloc);
+     u8_slice line;
+     while (tcp_stream_read_until(stream, '\n', &line) == TCP_RW_OK) {
+         tcp_stream_write(stream, line);
+     }
+     tcp_stream_flush(stream);
+     sa_free(alloc, stream);
+*/
+
+typedef struct tcp_stream tcp_stream;
+
+/* Stream over connection with buffers of the given sizes, allocated from alloc. */
+tcp_stream* tcp_stream_open(tcp* connection, uptr input_size, uptr output_size, stack_alloc* alloc);
+
+/* Next bytes up to and including delimiter. TCP_RW_ERR if the input buffer fills up first. */
+tcp_rw_status tcp_stream_read_until(tcp_stream* stream, u8 delimiter, u8_slice* out);
+/* Next size bytes, at most the input buffer size. */
+tcp_rw_status tcp_stream_read_exact(tcp_stream* stream, uptr size, u8_slice* out);
+
+/* Buffer or send data. res.bytes holds the bytes taken, less than the data only with
+   TCP_RW_AGAIN or TCP_RW_ERR. */
+tcp_w_result tcp_stream_write(tcp_stream* stream, u8_slice data);
+/* Send the buffered bytes. */
+tcp_rw_status tcp_stream_flush(tcp_stream* stream);
+/* Bytes buffered and not sent yet. */
+uptr tcp_stream_output_pending(const tcp_stream* stream);
+
+#endif /* TCP_STREAM_H */
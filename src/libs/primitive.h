@@ -25,6 +25,10 @@ typedef unsigned int         u32;
 typedef unsigned long        uptr;
 typedef unsigned long long   u64;
 
+// Floating point types
+typedef float                f32;
+typedef double               f64;
+
 // Size assertions
 STATIC_ASSERT(sizeof(i8) == 1);
 STATIC_ASSERT(sizeof(i16) == 2);
@@ -36,6 +40,8 @@ STATIC_ASSERT(sizeof(u16) == 2);
 STATIC_ASSERT(sizeof(u32) == 4);
 STATIC_ASSERT(sizeof(uptr) == sizeof(void*));
 STATIC_ASSERT(sizeof(u64) == 8);
+STATIC_ASSERT(sizeof(f32) == 4);
+STATIC_ASSERT(sizeof(f64) == 8);
 
 // Generic macro for byte offset calculation
 #define byteoffset(ptr, offset) (void*)((u8*)(ptr) + (offset))
@@ -1,21 +1,18 @@
 #include "print.h"
 #include "assert.h"
 #include "format_iterator.h"
+#include "meta_plan.h"
 
 // Print a plain string to file
 void print_string(file_t file, const string string) {
     file_write(file, string.begin, string.end);
 }
 
-// Print a formatted string with arguments to file
-void print_format(file_t file, string format, ...) {
+static void print_format_va(file_writer* writer, string format, va_list args) {
     u8 stack[2048];
     stack_alloc alloc;
     sa_init(&alloc, stack, byteoffset(stack, sizeof(stack)));
 
-    va_list args;
-    va_start(args, format);
-
     format_iterator* iter = format_iterator_init(&alloc, format, args);
 
     while (1) {
@@ -23,10 +20,35 @@ void print_format(file_t file, string format, ...) {
         if (fi.type == FORMAT_ITERATION_END) break;
         if (fi.type == FORMAT_ITERATION_CONTINUE) continue;
 
-        file_write(file, fi.text.begin, fi.text.end);
+        file_writer_write(writer, fi.text.begin, fi.text.end);
     }
 
     format_iterator_deinit(&alloc, iter);
+}
+
+// Print a formatted string with arguments to file
+// Segments are gathered in a local writer so that a call issues a single write in most cases
+void print_format(file_t file, string format, ...) {
+    u8 buffer[1024];
+    file_writer writer;
+    file_writer_init(&writer, file, buffer, byteoffset(buffer, sizeof(buffer)));
+
+    va_list args;
+    va_start(args, format);
+    print_format_va(&writer, format, args);
+    va_end(args);
+
+    file_writer_flush(&writer);
+}
+
+void print_string_to_writer(file_writer* writer, const string string) {
+    file_writer_write(writer, string.begin, string.end);
+}
+
+void print_format_to_writer(file_writer* writer, string format, ...) {
+    va_list args;
+    va_start(args, format);
+    print_format_va(writer, format, args);
     va_end(args);
 }
 
@@ -59,3 +81,121 @@ void* print_format_to_buffer(stack_alloc* alloc, string format, ...) {
 
     return start;
 }
+
+// Split format into literal segments and argument slots, the same way format_iterator reads it
+static void print_format_parse(string format, print_compiled_format* compiled) {
+    compiled->fallback = 0;
+    compiled->count = 0;
+    const char* current = format.begin;
+    const char* end = format.end;
+    while (current != end) {
+        print_format_segment segment = {current, current, {0}};
+        if (*current != '%') {
+            while (current != end && *current != '%') {
+                current++;
+            }
+        } else {
+            // Unknown specifiers stay literal text and consume no argument
+            current = format_spec_parse(current + 1, end, &segment.spec);
+        }
+        segment.end = current;
+        if (compiled->count == PRINT_FORMAT_MAX_SEGMENTS) {
+            compiled->fallback = 1;
+            return;
+        }
+        compiled->segments[compiled->count++] = segment;
+    }
+}
+
+static void print_padding(file_writer* writer, u32 padding) {
+    char spaces[FORMAT_SPEC_MAX_WIDTH];
+    __builtin_memset(spaces, ' ', padding);
+    file_writer_write(writer, spaces, spaces + padding);
+}
+
+static void print_meta(file_writer* writer, const meta* m, const void* data) {
+    char text[1024];
+    meta_plan_cursor cursor;
+    meta_plan_cursor_init(&cursor, meta_plan_get(m), data);
+    while (!meta_plan_cursor_done(&cursor)) {
+        char* end = meta_plan_write(&cursor, text, text + sizeof(text));
+        file_writer_write(writer, text, end);
+    }
+}
+
+const print_compiled_format* print_format_compile(print_compiled_format* compiled, string format, print_compiled_format* local) {
+    if (__atomic_load_n(&compiled->state, __ATOMIC_ACQUIRE) == 2) {
+        return compiled;
+    }
+    print_format_parse(format, local);
+    // Publish the segments once, concurrent first calls keep using their own copy
+    u32 expected = 0;
+    if (__atomic_compare_exchange_n(&compiled->state, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        compiled->fallback = local->fallback;
+        compiled->count = local->count;
+        __builtin_memcpy(compiled->segments, local->segments, sizeof(local->segments[0]) * local->count);
+        __atomic_store_n(&compiled->state, 2, __ATOMIC_RELEASE);
+    }
+    return local;
+}
+
+void print_format_compiled_va(file_writer* writer, print_compiled_format* compiled, string format, va_list args) {
+    print_compiled_format local;
+    const print_compiled_format* parsed = print_format_compile(compiled, format, &local);
+    debug_assert(parsed->count == 0 || parsed->segments[0].begin == format.begin);
+
+    if (parsed->fallback) {
+        print_format_va(writer, format, args);
+        return;
+    }
+
+    va_list arguments;
+    va_copy(arguments, args);
+    for (const print_format_segment* segment = parsed->segments; segment < parsed->segments + parsed->count; ++segment) {
+        const format_spec* spec = &segment->spec;
+        if (spec->conversion == 0) {
+            file_writer_write(writer, segment->begin, segment->end);
+        } else if (spec->conversion == 's') {
+            string value = va_arg(arguments, const string);
+            if (!value.begin || !value.end) {
+                value = STRING("(null)");
+            }
+            const u32 padding = format_spec_padding(spec, bytesize(value.begin, value.end));
+            if (!spec->left_align) {
+                print_padding(writer, padding);
+            }
+            file_writer_write(writer, value.begin, value.end);
+            if (spec->left_align) {
+                print_padding(writer, padding);
+            }
+        } else if (spec->conversion == 'm') {
+            const meta* m = va_arg(arguments, const meta*);
+            print_meta(writer, m, va_arg(arguments, const void*));
+        } else {
+            char text[FORMAT_SPEC_MAX_CHARS];
+            char* end = format_spec_write_arg(spec, &arguments, text);
+            file_writer_write(writer, text, end);
+        }
+    }
+    va_end(arguments);
+}
+
+void print_format_compiled(file_t file, print_compiled_format* compiled, string format, ...) {
+    u8 buffer[1024];
+    file_writer writer;
+    file_writer_init(&writer, file, buffer, byteoffset(buffer, sizeof(buffer)));
+
+    va_list args;
+    va_start(args, format);
+    print_format_compiled_va(&writer, compiled, format, args);
+    va_end(args);
+
+    file_writer_flush(&writer);
+}
+
+void print_format_compiled_to_writer(file_writer* writer, print_compiled_format* compiled, string format, ...) {
+    va_list args;
+    va_start(args, format);
+    print_format_compiled_va(writer, compiled, format, args);
+    va_end(args);
+}
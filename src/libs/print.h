@@ -3,12 +3,59 @@
 
 #include "file.h"
 #include "litteral.h"
+#include "format_iterator.h"
 
 // File-based print functions using file.h
 void print_string(file_t file, string string);
 void print_format(file_t file, string format, ...);
 
+// Buffered writer print functions, output is sent when the writer is flushed or full
+void print_string_to_writer(file_writer* writer, string string);
+void print_format_to_writer(file_writer* writer, string format, ...);
+
 // Stack allocator-based print functions
 void* print_format_to_buffer(stack_alloc* alloc, string format, ...);
 
+// Pre-parsed format strings
+//
+// PRINT_FORMAT and PRINT_FORMAT_TO_WRITER parse their format on the first call only and keep the
+// literal segments and argument slots in a static cache owned by the call site. Later calls
+// convert the arguments straight into the output buffer, so a PRINT_FORMAT call issues a single
+// write in most cases. The format must be the same on every call of a call site, typically a
+// STRING literal. Formats split into more than PRINT_FORMAT_MAX_SEGMENTS segments are printed by
+// print_format.
+//
+// Example usage:
+//   PRINT_FORMAT(file_stdout(), STRING("Builds took: %ums.\n"), elapsed_ms);
+#define PRINT_FORMAT_MAX_SEGMENTS 16
+
+typedef struct {
+    const char* begin;
+    const char* end;
+    format_spec spec;           // conversion is 0 for literal text
+} print_format_segment;
+
+typedef struct {
+    u32 state;                  // 0: not parsed, 1: being stored, 2: ready
+    u8 fallback;                // Printed by print_format
+    u8 count;
+    print_format_segment segments[PRINT_FORMAT_MAX_SEGMENTS];
+} print_compiled_format;
+
+void print_format_compiled(file_t file, print_compiled_format* compiled, string format, ...);
+void print_format_compiled_to_writer(file_writer* writer, print_compiled_format* compiled, string format, ...);
+void print_format_compiled_va(file_writer* writer, print_compiled_format* compiled, string format, va_list args);
+// Segments of format, parsed into local until they are stored in compiled.
+const print_compiled_format* print_format_compile(print_compiled_format* compiled, string format, print_compiled_format* local);
+
+#define PRINT_FORMAT(file, ...) do { \
+    static print_compiled_format print_compiled_format_; \
+    print_format_compiled((file), &print_compiled_format_, __VA_ARGS__); \
+} while (0)
+
+#define PRINT_FORMAT_TO_WRITER(writer, ...) do { \
+    static print_compiled_format print_compiled_format_; \
+    print_format_compiled_to_writer((writer), &print_compiled_format_, __VA_ARGS__); \
+} while (0)
+
 #endif /* PRINT_H */
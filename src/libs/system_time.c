@@ -1,7 +1,17 @@
 #include "system_time.h"
 #include <sys/syscall.h>
 #include <unistd.h>
-#include <linux/time.h>  // struct timespec
+#include <sys/stat.h>  // struct timespec, <linux/time.h> clashes with the libc struct timeval
+
+// <time.h> resolves to the local time.h, the clock id is the same for the kernel and libc
+#ifndef CLOCK_REALTIME
+#define CLOCK_REALTIME 0
+#endif
+#ifndef CLOCK_MONOTONIC
+#define CLOCK_MONOTONIC 1
+#endif
+// Declared by <time.h>, the libc call reads the clock through the vDSO without a syscall
+int clock_gettime(int clock_id, struct timespec* ts);
 
 // Milliseconds since epoch
 u64 sys_time_ms(void) {
@@ -23,3 +33,10 @@ u64 sys_time_us(void) {
     syscall(SYS_clock_gettime, CLOCK_REALTIME, &ts);
     return (u64)ts.tv_sec * 1000000ULL + (u64)ts.tv_nsec / 1000ULL;
 }
+
+// Nanoseconds of a monotonic clock with an unspecified origin
+u64 sys_time_monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000ULL + (u64)ts.tv_nsec;
+}
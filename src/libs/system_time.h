@@ -12,4 +12,7 @@ u64 sys_time_s(void);
 // Returns current time in microseconds since Unix epoch
 u64 sys_time_us(void);
 
+// Returns nanoseconds of a monotonic clock with an unspecified origin, cheap enough for hot paths
+u64 sys_time_monotonic_ns(void);
+
 #endif // SYSTEM_TIME_H
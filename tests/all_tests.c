@@ -11,6 +11,13 @@
 #include "test_snake.h"
 #include "test_network_https.h"
 #include "test_network_tcp.h"
+#include "test_hash_map.h"
+#include "test_convert.h"
+#include "test_meta_serialize.h"
+#include "test_json.h"
+#include "test_log.h"
+#include "test_async_io.h"
+#include "test_directory_walk.h"
 
 #include "print.h"
 #include "file.h"
@@ -18,7 +25,7 @@
 
 int main(int argc, char* argv[]) {
     // Global memory pointer
-    uptr size = 1024*2;
+    uptr size = 1024*4;
     void* pointer = mem_map(size);
 
     // Initialize the allocator
@@ -44,6 +51,7 @@ int main(int argc, char* argv[]) {
                     sa_equals(&alloc, arg.begin, arg.end, h.begin, h.end) == 0) {
             print_string(file_stdout(), STRING("Usage: all_tests [--filter <pattern>]\n"));
             print_string(file_stdout(), STRING("  --filter <pattern>: Run only tests matching the pattern (supports * wildcards)\n"));
+            print_string(file_stdout(), STRING("  --filter bench: Run the benchmarks, left out of the default run\n"));
             print_string(file_stdout(), STRING("  --help: Show this help message\n"));
             return 0;
         }
@@ -51,15 +59,22 @@ int main(int argc, char* argv[]) {
 
     print_string(file_stdout(), STRING("Test Suite Starting...\n"));
     if (ctx->filter_pattern.begin) {
-        print_format(file_stdout(), STRING("Filter: %s\n"), ctx->filter_pattern);
+        PRINT_FORMAT(file_stdout(), STRING("Filter: %s\n"), ctx->filter_pattern);
     }
 
     // Register all tests
     test_mem_module(ctx);
     test_sa_module(ctx);
+    test_hash_map_module(ctx);
+    test_convert_module(ctx);
+    test_meta_serialize_module(ctx);
+    test_json_module(ctx);
     test_win_x11_module(ctx);
     test_file_module(ctx);
+    test_async_io_module(ctx);
+    test_directory_walk_module(ctx);
     test_print_module(ctx);
+    test_log_module(ctx);
     test_backtrace_module(ctx);
     test_exec_command_module(ctx);
     test_lzss_module(ctx);
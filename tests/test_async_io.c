@@ -0,0 +1,179 @@
+#include "test_async_io.h"
+#include "test_temp_dir.h"
+#include "async_io.h"
+#include "file.h"
+#include "mem.h"
+#include "litteral.h"
+#include "print.h"
+#include "network/tcp/tcp_connection.h"
+
+static const string path_test_async = STR("test_temp/test_async.txt");
+
+// Wait until 'count' operations have finished, storing their results by user_data
+static u8 async_io_wait_all(async_io* io, iptr* results, u32 count) {
+    async_io_completion completions[8];
+    u32 finished = 0;
+    for (i32 iteration = 0; iteration < 1000 && finished < count; ++iteration) {
+        const u32 got = async_io_complete(io, completions, completions + 8, 1);
+        for (u32 i = 0; i < got; ++i) {
+            results[completions[i].user_data] = completions[i].result;
+        }
+        finished += got;
+    }
+    return finished == count;
+}
+
+static void async_io_file_check(test_context* t, async_io_backend backend) {
+    setup_test_temp_dir();
+
+    const uptr stack_size = 1024 * 64;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    file_t file = file_open(&alloc, path_test_async.begin, path_test_async.end, FILE_MODE_READ_WRITE);
+    TEST_ASSERT_NOT_EQUAL(t, file, file_invalid());
+
+    async_io* io = async_io_init(&alloc, 16, 1024 * 16, backend);
+    TEST_ASSERT_NOT_NULL(t, io);
+    if (backend == ASYNC_IO_BACKEND_EPOLL) {
+        TEST_ASSERT_EQUAL(t, async_io_get_backend(io), ASYNC_IO_BACKEND_EPOLL);
+    }
+
+    // Write 8 blocks at their offsets in one batch
+    enum {block_count = 8, block_size = 512};
+    u8* blocks = sa_alloc(async_io_buffers(io), block_count * block_size);
+    for (uptr i = 0; i < block_count * block_size; ++i) {
+        blocks[i] = (u8)(i * 13);
+    }
+    for (u32 b = 0; b < block_count; ++b) {
+        u8* block = blocks + b * block_size;
+        TEST_ASSERT_TRUE(t, async_io_write(io, file, block, block + block_size, b * block_size, b));
+    }
+    TEST_ASSERT_EQUAL(t, async_io_submit(io), block_count);
+
+    iptr results[block_count];
+    TEST_ASSERT_TRUE(t, async_io_wait_all(io, results, block_count));
+    for (u32 b = 0; b < block_count; ++b) {
+        TEST_ASSERT_EQUAL(t, results[b], block_size);
+    }
+
+    // Read them back in reverse order, half in registered buffers, half in regular memory
+    u8* read_fixed = sa_alloc(async_io_buffers(io), block_count / 2 * block_size);
+    u8 read_regular[block_count / 2 * block_size];
+    for (u32 b = 0; b < block_count; ++b) {
+        const u32 block = block_count - 1 - b;
+        u8* destination = b % 2 ? read_fixed + b / 2 * block_size : read_regular + b / 2 * block_size;
+        TEST_ASSERT_TRUE(t, async_io_read(io, file, (u8_slice){destination, destination + block_size}, block * block_size, b));
+    }
+    TEST_ASSERT_EQUAL(t, async_io_submit(io), block_count);
+    TEST_ASSERT_TRUE(t, async_io_wait_all(io, results, block_count));
+
+    u8 content_matches = 1;
+    for (u32 b = 0; b < block_count; ++b) {
+        const u32 block = block_count - 1 - b;
+        const u8* destination = b % 2 ? read_fixed + b / 2 * block_size : read_regular + b / 2 * block_size;
+        if (results[b] != block_size) {content_matches = 0;}
+        for (u32 i = 0; i < block_size; ++i) {
+            if (destination[i] != blocks[block * block_size + i]) {content_matches = 0;}
+        }
+    }
+    TEST_ASSERT_TRUE(t, content_matches);
+
+    // Queued but not submitted: waiting sends it instead of blocking
+    async_io_completion completion;
+    TEST_ASSERT_TRUE(t, async_io_read(io, file, (u8_slice){read_fixed, read_fixed + block_size}, 0, 0));
+    TEST_ASSERT_EQUAL(t, async_io_complete(io, &completion, &completion + 1, 1), 1);
+    TEST_ASSERT_EQUAL(t, completion.result, block_size);
+
+    // Completed or not, queue_size operations in flight fill the queue
+    const u32 queue_size = 16;
+    for (u32 i = 0; i < queue_size; ++i) {
+        TEST_ASSERT_TRUE(t, async_io_read(io, file, (u8_slice){read_fixed, read_fixed + block_size}, 0, i));
+        if (i % 4 == 3) {
+            async_io_submit(io);
+        }
+    }
+    TEST_ASSERT_FALSE(t, async_io_read(io, file, (u8_slice){read_fixed, read_fixed + block_size}, 0, 0));
+    iptr queue_results[16];
+    TEST_ASSERT_TRUE(t, async_io_wait_all(io, queue_results, queue_size));
+    TEST_ASSERT_TRUE(t, async_io_read(io, file, (u8_slice){read_fixed, read_fixed + block_size}, 0, 0));
+    TEST_ASSERT_EQUAL(t, async_io_complete(io, &completion, &completion + 1, 1), 1);
+
+    // Nothing in flight: waiting returns immediately
+    TEST_ASSERT_EQUAL(t, async_io_complete(io, &completion, &completion + 1, 1), 0);
+
+    async_io_deinit(&alloc, io);
+    file_close(file);
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    cleanup_test_temp_dir();
+}
+
+static void test_async_io_file(test_context* t) {
+    async_io_file_check(t, ASYNC_IO_BACKEND_DEFAULT);
+    async_io_file_check(t, ASYNC_IO_BACKEND_EPOLL);
+}
+
+static void async_io_tcp_check(test_context* t, async_io_backend backend) {
+    const uptr stack_size = 1024 * 64;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    string _host = STR("127.0.0.1");
+    u8_slice host = {(void*)_host.begin, (void*)_host.end};
+    string _port = STR("8001");
+    u8_slice port = {(void*)_port.begin, (void*)_port.end};
+
+    tcp* server = tcp_init_server(host, port, &alloc);
+    TEST_ASSERT_NOT_NULL(t, server);
+    tcp* client = tcp_init_client(host, port, &alloc);
+    TEST_ASSERT_NOT_EQUAL(t, tcp_get_interal(client), file_invalid());
+
+    async_io* io = async_io_init(&alloc, 8, 1024, backend);
+    TEST_ASSERT_NOT_NULL(t, io);
+
+    // Accept and connect driven by the same thread
+    enum {op_accept, op_connect, op_write, op_read, op_count};
+    iptr results[op_count];
+    TEST_ASSERT_TRUE(t, async_io_accept(io, server, op_accept));
+    TEST_ASSERT_TRUE(t, async_io_connect(io, client, op_connect));
+    async_io_submit(io);
+    TEST_ASSERT_TRUE(t, async_io_wait_all(io, results, 2));
+    TEST_ASSERT_EQUAL(t, results[op_connect], 0);
+    TEST_ASSERT_TRUE(t, results[op_accept] >= 0);
+    const file_t peer = (file_t)results[op_accept];
+
+    const string message = STR("hello through async io");
+    const uptr message_size = bytesize(message.begin, message.end);
+    u8* received = sa_alloc(async_io_buffers(io), 64);
+    TEST_ASSERT_TRUE(t, async_io_read(io, peer, (u8_slice){received, received + 64}, -1, op_read));
+    TEST_ASSERT_TRUE(t, async_io_write(io, tcp_get_interal(client), message.begin, message.end, -1, op_write));
+    async_io_submit(io);
+    TEST_ASSERT_TRUE(t, async_io_wait_all(io, results, 2));
+    TEST_ASSERT_EQUAL(t, results[op_write], (iptr)message_size);
+    TEST_ASSERT_EQUAL(t, results[op_read], (iptr)message_size);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, received, received + message_size, message.begin, message.end));
+
+    async_io_deinit(&alloc, io);
+    file_close(peer);
+    tcp_close(client);
+    tcp_close(server);
+    sa_free(&alloc, server);
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+}
+
+static void test_async_io_tcp(test_context* t) {
+    async_io_tcp_check(t, ASYNC_IO_BACKEND_DEFAULT);
+    async_io_tcp_check(t, ASYNC_IO_BACKEND_EPOLL);
+}
+
+void test_async_io_module(test_context* t) {
+    print_string(file_stdout(), STRING("Registering Async IO Module Tests...\n"));
+
+    REGISTER_TEST(t, "async_io_file", test_async_io_file);
+    REGISTER_TEST(t, "async_io_tcp", test_async_io_tcp);
+}
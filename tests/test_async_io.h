@@ -0,0 +1,9 @@
+#ifndef TEST_ASYNC_IO_H
+#define TEST_ASYNC_IO_H
+
+#include "test_framework.h"
+
+// Declaration of async io module test function
+void test_async_io_module(test_context* t);
+
+#endif /* TEST_ASYNC_IO_H */
@@ -0,0 +1,258 @@
+// Tests for convert module
+#include "test_convert.h"
+#include "convert.h"
+#include "mem.h"
+#include "print.h"
+#include "system_time.h"
+
+#include <stdio.h>  // snprintf, reference for the float benchmark
+#include <stdlib.h> // strtod
+
+// Digit-by-digit conversion used before the lookup table core, kept as reference
+static char* reference_u64_to_string(u64 value, stack_alloc* alloc) {
+    char temp[32];
+    int count = 0;
+    do {
+        temp[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    char* result = sa_alloc(alloc, (uptr)count);
+    for (int i = 0; i < count; ++i) {
+        result[i] = temp[count - 1 - i];
+    }
+    return result;
+}
+
+static char* reference_i64_to_string(i64 value, stack_alloc* alloc) {
+    if (value >= 0) {
+        return reference_u64_to_string((u64)value, alloc);
+    }
+    char* result = sa_alloc(alloc, 1);
+    *result = '-';
+    reference_u64_to_string(-(u64)value, alloc);
+    return result;
+}
+
+static u64 next_random(u64* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Compare the conversion of value with the reference, both allocated from alloc
+static u8 matches_reference(stack_alloc* alloc, u64 value) {
+    char* begin = alloc->cursor;
+    convert_u64_to_string(value, alloc);
+    char* reference = alloc->cursor;
+    reference_u64_to_string(value, alloc);
+    u8 equal = sa_equals(alloc, begin, reference, reference, alloc->cursor);
+
+    char* signed_begin = alloc->cursor;
+    convert_i64_to_string((i64)value, alloc);
+    char* signed_reference = alloc->cursor;
+    reference_i64_to_string((i64)value, alloc);
+    equal &= sa_equals(alloc, signed_begin, signed_reference, signed_reference, alloc->cursor);
+
+    sa_free(alloc, begin);
+    return equal;
+}
+
+static void test_convert_decimal(test_context* t) {
+    uptr size = 4096;
+    void* mem = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, mem, byteoffset(mem, size));
+
+    // Around every power of ten, where the digit count changes
+    u8 equal = matches_reference(&alloc, 0) && matches_reference(&alloc, ~0ull);
+    for (u64 power = 1; power <= 1000000000000000000ull; power *= 10) {
+        equal &= matches_reference(&alloc, power - 1);
+        equal &= matches_reference(&alloc, power);
+        equal &= matches_reference(&alloc, power + 1);
+    }
+    TEST_ASSERT_TRUE(t, equal);
+
+    u64 state = 88172645463325252ull;
+    for (u32 i = 0; i < 10000; ++i) {
+        const u64 value = next_random(&state);
+        // Spread the values over every length
+        equal &= matches_reference(&alloc, value >> (value & 63));
+    }
+    TEST_ASSERT_TRUE(t, equal);
+
+    // Narrow types and their limits
+    const string i8_min = STR("-128");
+    char* text = convert_i8_to_string((i8)-128, &alloc);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, text, alloc.cursor, i8_min.begin, i8_min.end));
+    sa_free(&alloc, text);
+
+    const string i64_min = STR("-9223372036854775808");
+    text = convert_i64_to_string((i64)(1ull << 63), &alloc);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, text, alloc.cursor, i64_min.begin, i64_min.end));
+    sa_free(&alloc, text);
+
+    const string u16_max = STR("65535");
+    text = convert_u16_to_string(65535, &alloc);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, text, alloc.cursor, u16_max.begin, u16_max.end));
+    sa_free(&alloc, text);
+
+    TEST_ASSERT_EQUAL(t, alloc.cursor, mem);
+    sa_deinit(&alloc);
+    mem_unmap(mem, size);
+}
+
+static void test_convert_hex(test_context* t) {
+    uptr size = 4096;
+    void* mem = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, mem, byteoffset(mem, size));
+
+    const string zero = STR("0");
+    char* text = convert_u64_to_hex_string(0, 0, &alloc);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, text, alloc.cursor, zero.begin, zero.end));
+    sa_free(&alloc, text);
+
+    const string max = STR("ffffffffffffffff");
+    text = convert_u64_to_hex_string(~0ull, 0, &alloc);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, text, alloc.cursor, max.begin, max.end));
+    sa_free(&alloc, text);
+
+    const string padded = STR("00000abc");
+    text = convert_u64_to_hex_string(0xabc, 8, &alloc);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, text, alloc.cursor, padded.begin, padded.end));
+    sa_free(&alloc, text);
+
+    const string pointer = STR("0x0000beef");
+    text = convert_pointer_to_string((void*)0xbeef, &alloc);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, text, alloc.cursor, pointer.begin, pointer.end));
+    sa_free(&alloc, text);
+
+    const string null = STR("0x0");
+    text = convert_pointer_to_string(0, &alloc);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, text, alloc.cursor, null.begin, null.end));
+    sa_free(&alloc, text);
+
+    sa_deinit(&alloc);
+    mem_unmap(mem, size);
+}
+
+static u8 float_equals(stack_alloc* alloc, f64 value, convert_float_format format, string expected) {
+    char* text = convert_f64_to_string(value, format, alloc);
+    const u8 equal = sa_equals(alloc, text, alloc->cursor, expected.begin, expected.end);
+    sa_free(alloc, text);
+    return equal;
+}
+
+static void test_convert_float(test_context* t) {
+    uptr size = 4096;
+    void* mem = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, mem, byteoffset(mem, size));
+
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 0.1, CONVERT_FLOAT_FIXED, STRING("0.1")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 0.1 + 0.2, CONVERT_FLOAT_FIXED, STRING("0.30000000000000004")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 1500000.0, CONVERT_FLOAT_FIXED, STRING("1500000")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, -12.375, CONVERT_FLOAT_FIXED, STRING("-12.375")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 0.00125, CONVERT_FLOAT_FIXED, STRING("0.00125")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 0.00125, CONVERT_FLOAT_SCIENTIFIC, STRING("1.25e-3")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 1500000.0, CONVERT_FLOAT_SCIENTIFIC, STRING("1.5e6")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 1e100, CONVERT_FLOAT_GENERAL, STRING("1e100")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 1e-5, CONVERT_FLOAT_GENERAL, STRING("1e-5")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 1e-4, CONVERT_FLOAT_GENERAL, STRING("0.0001")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 123.456, CONVERT_FLOAT_GENERAL, STRING("123.456")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 1.7976931348623157e308, CONVERT_FLOAT_GENERAL, STRING("1.7976931348623157e308")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 5e-324, CONVERT_FLOAT_GENERAL, STRING("5e-324")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, 0.0, CONVERT_FLOAT_GENERAL, STRING("0")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, -0.0, CONVERT_FLOAT_GENERAL, STRING("-0")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, __builtin_inf(), CONVERT_FLOAT_FIXED, STRING("inf")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, -__builtin_inf(), CONVERT_FLOAT_FIXED, STRING("-inf")));
+    TEST_ASSERT_TRUE(t, float_equals(&alloc, __builtin_nan(""), CONVERT_FLOAT_FIXED, STRING("nan")));
+
+    // The longest output fits
+    char* text = convert_f64_to_string(-2.2250738585072014e-308, CONVERT_FLOAT_FIXED, &alloc);
+    TEST_ASSERT_TRUE(t, bytesize(text, alloc.cursor) <= CONVERT_F64_MAX_CHARS);
+    sa_free(&alloc, text);
+
+    // Random bit patterns parse back to the same value
+    u64 state = 88172645463325252ull;
+    u8 round_trip = 1;
+    for (u32 i = 0; i < 100000; ++i) {
+        u64 bits = next_random(&state);
+        if ((bits >> 52 & 0x7ff) == 0x7ff) {
+            continue;
+        }
+        f64 value;
+        __builtin_memcpy(&value, &bits, sizeof(value));
+        char buffer[CONVERT_F64_MAX_CHARS + 1];
+        *convert_f64_to_chars(value, CONVERT_FLOAT_GENERAL, buffer) = '\0';
+        round_trip &= strtod(buffer, 0) == value;
+    }
+    TEST_ASSERT_TRUE(t, round_trip);
+
+    TEST_ASSERT_EQUAL(t, alloc.cursor, mem);
+    sa_deinit(&alloc);
+    mem_unmap(mem, size);
+}
+
+// Compare the lookup table core with the reference, timings are reported but not asserted
+static void test_convert_benchmark(test_context* t) {
+    uptr size = 4096;
+    void* mem = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, mem, byteoffset(mem, size));
+
+    const u32 iterations = 1000000;
+    u64 checksum[2] = {0, 0};
+    u64 elapsed_us[2];
+    for (u32 pass = 0; pass < 2; ++pass) {
+        u64 state = 88172645463325252ull;
+        const u64 begin_us = sys_time_us();
+        for (u32 i = 0; i < iterations; ++i) {
+            const u64 value = next_random(&state);
+            char* text = pass == 0 ? convert_u64_to_string(value >> (value & 63), &alloc) : reference_u64_to_string(value >> (value & 63), &alloc);
+            checksum[pass] += bytesize(text, alloc.cursor) + (u8)text[0];
+            sa_free(&alloc, text);
+        }
+        elapsed_us[pass] = sys_time_us() - begin_us;
+    }
+    TEST_ASSERT_EQUAL(t, checksum[0], checksum[1]);
+    print_format(file_stdout(), STRING("convert u64: %llums for %u values, digit by digit: %llums\n"),
+        elapsed_us[0] / 1000, iterations, elapsed_us[1] / 1000);
+
+    sa_deinit(&alloc);
+    mem_unmap(mem, size);
+}
+
+// Compare the shortest f64 conversion with snprintf("%.17g"), timings are reported but not asserted
+static void test_convert_float_benchmark(test_context* t) {
+    const u32 iterations = 1000000;
+    u64 lengths[2] = {0, 0};
+    u64 elapsed_us[2];
+    for (u32 pass = 0; pass < 2; ++pass) {
+        u64 state = 88172645463325252ull;
+        const u64 begin_us = sys_time_us();
+        for (u32 i = 0; i < iterations; ++i) {
+            // Metric-like values
+            const f64 value = (f64)(next_random(&state) % 100000000) / 1000.0;
+            char buffer[CONVERT_F64_MAX_CHARS];
+            if (pass == 0) {
+                lengths[pass] += bytesize(buffer, convert_f64_to_chars(value, CONVERT_FLOAT_GENERAL, buffer));
+            } else {
+                lengths[pass] += (u64)snprintf(buffer, sizeof(buffer), "%.17g", value);
+            }
+        }
+        elapsed_us[pass] = sys_time_us() - begin_us;
+    }
+    TEST_ASSERT_TRUE(t, lengths[0] <= lengths[1]);
+    print_format(file_stdout(), STRING("convert f64: %llums for %u values, snprintf: %llums\n"),
+        elapsed_us[0] / 1000, iterations, elapsed_us[1] / 1000);
+}
+
+void test_convert_module(test_context* t) {
+    REGISTER_TEST(t, "convert_decimal", test_convert_decimal);
+    REGISTER_TEST(t, "convert_hex", test_convert_hex);
+    REGISTER_TEST(t, "convert_float", test_convert_float);
+    REGISTER_BENCHMARK(t, "convert", test_convert_benchmark);
+    REGISTER_BENCHMARK(t, "convert_float", test_convert_float_benchmark);
+}
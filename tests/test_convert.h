@@ -0,0 +1,9 @@
+#ifndef TEST_CONVERT_H
+#define TEST_CONVERT_H
+
+#include "test_framework.h"
+
+// Declaration of convert module test function
+void test_convert_module(test_context* t);
+
+#endif /* TEST_CONVERT_H */
@@ -0,0 +1,100 @@
+#include "test_directory_walk.h"
+#include "test_temp_dir.h"
+#include "directory_walk.h"
+#include "file.h"
+#include "mem.h"
+#include "litteral.h"
+#include "print.h"
+
+static const string path_tree = STR("test_temp/tree");
+
+typedef struct {
+    uptr files;
+    uptr directories;
+    uptr leaves;
+    uptr max_depth;
+} walk_counts;
+
+static u8 count_visit(const directory_entry* entry, void* user) {
+    walk_counts* counts = user;
+    if (entry->type == DIRECTORY_ENTRY_FILE) {__atomic_fetch_add(&counts->files, 1, __ATOMIC_RELAXED);}
+    if (entry->type == DIRECTORY_ENTRY_DIRECTORY) {__atomic_fetch_add(&counts->directories, 1, __ATOMIC_RELAXED);}
+    uptr depth = __atomic_load_n(&counts->max_depth, __ATOMIC_RELAXED);
+    while (entry->depth > depth && !__atomic_compare_exchange_n(&counts->max_depth, &depth, entry->depth, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+    return 1;
+}
+
+static void count_leave(const directory_entry* entry, void* user) {
+    walk_counts* counts = user;
+    if (entry->type == DIRECTORY_ENTRY_DIRECTORY) {__atomic_fetch_add(&counts->leaves, 1, __ATOMIC_RELAXED);}
+}
+
+// test_temp/tree/d<i>/e<j>/f<k> with one file at the root and one in each d<i>
+static void create_tree(stack_alloc* alloc) {
+    directory_create(alloc, path_tree.begin, path_tree.end, DIR_MODE_DEFAULT);
+    void* begin = alloc->cursor;
+    string path = {print_format_to_buffer(alloc, STRING("%s/root_file"), path_tree), alloc->cursor};
+    file_close(file_open(alloc, path.begin, path.end, FILE_MODE_WRITE));
+    sa_free(alloc, begin);
+
+    for (u32 i = 0; i < 3; ++i) {
+        path = (string){print_format_to_buffer(alloc, STRING("%s/d%u/file"), path_tree, i), alloc->cursor};
+        directory_create_for_file(alloc, path.begin, path.end, DIR_MODE_DEFAULT);
+        file_close(file_open(alloc, path.begin, path.end, FILE_MODE_WRITE));
+        sa_free(alloc, begin);
+        for (u32 j = 0; j < 2; ++j) {
+            for (u32 k = 0; k < 4; ++k) {
+                path = (string){print_format_to_buffer(alloc, STRING("%s/d%u/e%u/f%u"), path_tree, i, j, k), alloc->cursor};
+                directory_create_for_file(alloc, path.begin, path.end, DIR_MODE_DEFAULT);
+                file_close(file_open(alloc, path.begin, path.end, FILE_MODE_WRITE));
+                sa_free(alloc, begin);
+            }
+        }
+    }
+}
+
+static void directory_walk_check(test_context* t, u32 thread_count) {
+    setup_test_temp_dir();
+
+    const uptr stack_size = 1024 * 8;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    create_tree(&alloc);
+
+    walk_counts counts = {0};
+    const u8 walked = directory_walk(&alloc, path_tree.begin, path_tree.end, (directory_walk_callbacks){count_visit, count_leave, &counts}, thread_count);
+    TEST_ASSERT_TRUE(t, walked);
+    TEST_ASSERT_EQUAL(t, counts.files, 1 + 3 + 3 * 2 * 4);
+    TEST_ASSERT_EQUAL(t, counts.directories, 3 + 3 * 2);
+    TEST_ASSERT_EQUAL(t, counts.leaves, counts.directories);
+    TEST_ASSERT_EQUAL(t, counts.max_depth, 3);
+    TEST_ASSERT_EQUAL(t, alloc.cursor, alloc.begin);
+
+    // Removal leaves nothing behind
+    directory_walk_remove(&alloc, path_tree.begin, path_tree.end, thread_count);
+    file_t removed = file_open(&alloc, path_tree.begin, path_tree.end, FILE_MODE_READ);
+    TEST_ASSERT_EQUAL(t, removed, file_invalid());
+    TEST_ASSERT_FALSE(t, directory_walk(&alloc, path_tree.begin, path_tree.end, (directory_walk_callbacks){count_visit, count_leave, &counts}, thread_count));
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    cleanup_test_temp_dir();
+}
+
+static void test_directory_walk_sequential(test_context* t) {
+    directory_walk_check(t, 1);
+}
+
+static void test_directory_walk_parallel(test_context* t) {
+    directory_walk_check(t, 4);
+}
+
+void test_directory_walk_module(test_context* t) {
+    print_string(file_stdout(), STRING("Registering Directory Walk Module Tests...\n"));
+
+    REGISTER_TEST(t, "directory_walk_sequential", test_directory_walk_sequential);
+    REGISTER_TEST(t, "directory_walk_parallel", test_directory_walk_parallel);
+}
@@ -0,0 +1,9 @@
+#ifndef TEST_DIRECTORY_WALK_H
+#define TEST_DIRECTORY_WALK_H
+
+#include "test_framework.h"
+
+// Declaration of directory walk module test function
+void test_directory_walk_module(test_context* t);
+
+#endif /* TEST_DIRECTORY_WALK_H */
@@ -7,6 +7,14 @@
 #include "mem.h"
 #include "file.h"
 #include "print.h"
+#include "system_time.h"
+#include "convert.h"
+#include "thread.h"
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 // Paths for the files we'll create and then list
 static const string path_exec_test_file1 = STR("test_temp/exec_test_file.txt");
@@ -76,6 +84,322 @@ static void test_exec_command_ls_lists_files_on_multiple_lines(test_context* t)
     TEST_ASSERT_TRUE(t, 1);
 }
 
+// Commands of a pool run at the same time, each output lands in its own region
+static void test_exec_command_pool_parallel(test_context* t) {
+    const uptr size = 4096;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    exec_command_pool* pool = exec_command_pool_open(&alloc, 4);
+    const string commands[] = {
+        STR("sleep 0.3; echo first"),
+        STR("sleep 0.3; echo second"),
+        STR("sleep 0.3; echo third"),
+        STR("sleep 0.3; false"),
+    };
+    const u64 begin_ms = sys_time_ms();
+    u32 ids[4];
+    for (u32 i = 0; i < 4; ++i) {
+        ids[i] = exec_command_pool_submit(pool, commands[i]);
+        TEST_ASSERT_NOT_EQUAL(t, ids[i], 0);
+    }
+    // Every shell is in use
+    TEST_ASSERT_EQUAL(t, exec_command_pool_submit(pool, STRING("true")), 0);
+    // Nothing finishes this early
+    exec_command_completion done;
+    TEST_ASSERT_FALSE(t, exec_command_pool_poll(pool, 0, &done));
+
+    const string expected[] = {STR("first\n"), STR("second\n"), STR("third\n"), STR("")};
+    u32 finished = 0;
+    u8 outputs_match = 1;
+    while (exec_command_pool_poll(pool, -1, &done)) {
+        for (u32 i = 0; i < 4; ++i) {
+            if (done.id == ids[i]) {
+                outputs_match &= done.success == (i != 3);
+                outputs_match &= sa_equals(&alloc, done.output.begin, done.output.end, expected[i].begin, expected[i].end);
+            }
+        }
+        exec_command_pool_release(pool, done.id);
+        finished += 1;
+    }
+    TEST_ASSERT_EQUAL(t, finished, 4);
+    TEST_ASSERT_TRUE(t, outputs_match);
+    TEST_ASSERT_TRUE(t, sys_time_ms() - begin_ms < 1000);
+
+    // Released shells take new commands
+    const u32 id = exec_command_pool_submit(pool, STRING("echo again"));
+    TEST_ASSERT_NOT_EQUAL(t, id, 0);
+    TEST_ASSERT_TRUE(t, exec_command_pool_poll(pool, -1, &done));
+    const string again = STR("again\n");
+    TEST_ASSERT_TRUE(t, done.id == id && sa_equals(&alloc, done.output.begin, done.output.end, again.begin, again.end));
+    exec_command_pool_release(pool, done.id);
+
+    // A shell that exits is replaced, the next commands of its slot still run
+    for (u32 i = 0; i < 4; ++i) {
+        TEST_ASSERT_NOT_EQUAL(t, exec_command_pool_submit(pool, STRING("exit 3")), 0);
+    }
+    for (u32 i = 0; i < 4; ++i) {
+        TEST_ASSERT_TRUE(t, exec_command_pool_poll(pool, -1, &done));
+        TEST_ASSERT_EQUAL(t, done.exit_code, 3);
+        exec_command_pool_release(pool, done.id);
+    }
+    TEST_ASSERT_NOT_EQUAL(t, exec_command_pool_submit(pool, STRING("echo again")), 0);
+    TEST_ASSERT_TRUE(t, exec_command_pool_poll(pool, -1, &done));
+    TEST_ASSERT_TRUE(t, done.success && sa_equals(&alloc, done.output.begin, done.output.end, again.begin, again.end));
+    exec_command_pool_release(pool, done.id);
+
+    exec_command_pool_close(pool);
+    sa_free(&alloc, pool);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+// Output much larger than a pipe, read over many polls
+static void test_exec_command_pool_large_output(test_context* t) {
+    const uptr size = 4096;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    exec_command_pool* pool = exec_command_pool_open(&alloc, 2);
+    const u32 large = exec_command_pool_submit(pool, STRING("seq 1 100000"));
+    const u32 small = exec_command_pool_submit(pool, STRING("printf no_newline"));
+    exec_command_completion done;
+    u8 large_match = 0;
+    u8 small_match = 0;
+    while (exec_command_pool_poll(pool, -1, &done)) {
+        if (done.id == large) {
+            // 9 numbers of 1 digit, 90 of 2, 900 of 3, 9000 of 4, 90000 of 5 and 100000, with newlines
+            const uptr expected_size = 9 * 2 + 90 * 3 + 900 * 4 + 9000 * 5 + 90000 * 6 + 7;
+            const string last = STR("99999\n100000\n");
+            large_match = bytesize(done.output.begin, done.output.end) == expected_size
+                && sa_equals(&alloc, byteoffset(done.output.end, -(iptr)bytesize(last.begin, last.end)), done.output.end, last.begin, last.end);
+        } else if (done.id == small) {
+            const string expected = STR("no_newline");
+            small_match = done.success && sa_equals(&alloc, done.output.begin, done.output.end, expected.begin, expected.end);
+        }
+        exec_command_pool_release(pool, done.id);
+    }
+    TEST_ASSERT_TRUE(t, large_match);
+    TEST_ASSERT_TRUE(t, small_match);
+
+    exec_command_pool_close(pool);
+    sa_free(&alloc, pool);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+// Programs run without a shell, their output can hold the marker of the shell sessions
+static void test_exec_command_argv(test_context* t) {
+    const uptr size = 4096;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    const string echo[] = {STR("echo"), STR("__END__ 0"), STR("two words")};
+    exec_command_result result = exec_command_argv(echo, echo + 3, &alloc);
+    const string expected = STR("__END__ 0 two words\n");
+    TEST_ASSERT_TRUE(t, result.success);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, result.output, alloc.cursor, expected.begin, expected.end));
+    sa_free(&alloc, result.output);
+
+    const string exit_3[] = {STR("sh"), STR("-c"), STR("echo failing >&2; exit 3")};
+    result = exec_command_argv(exit_3, exit_3 + 3, &alloc);
+    const string failing = STR("failing\n");
+    TEST_ASSERT_FALSE(t, result.success);
+    TEST_ASSERT_EQUAL(t, result.exit_code, 3);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, result.output, alloc.cursor, failing.begin, failing.end));
+    sa_free(&alloc, result.output);
+
+    // The shell sessions report the same code
+    result = exec_command(STRING("(exit 3)"), &alloc);
+    TEST_ASSERT_EQUAL(t, result.exit_code, 3);
+    sa_free(&alloc, result.output);
+
+    const string missing[] = {STR("this_program_does_not_exist")};
+    result = exec_command_argv(missing, missing + 1, &alloc);
+    TEST_ASSERT_FALSE(t, result.success);
+    TEST_ASSERT_EQUAL(t, result.output, alloc.cursor);
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+typedef struct {
+    stack_alloc* alloc;
+    u32 chunks;
+    uptr largest_chunk;
+} stream_output;
+
+static void stream_output_append(void* context, string chunk) {
+    stream_output* stream = context;
+    sa_alloc_copy(stream->alloc, chunk.begin, chunk.end);
+    stream->chunks += 1;
+    if (bytesize(chunk.begin, chunk.end) > stream->largest_chunk) {
+        stream->largest_chunk = bytesize(chunk.begin, chunk.end);
+    }
+}
+
+// Output is handed over in chunks, parts of the marker written by the command stay in it
+static void test_exec_command_stream(test_context* t) {
+    const uptr size = 1024 * 1024;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+    exec_command_session* session = open_persistent_shell(&alloc);
+
+    void* output = alloc.cursor;
+    stream_output stream = {&alloc, 0, 0};
+    exec_command_result result = command_session_exec_command_stream(session, STRING("seq 1 100000"), stream_output_append, &stream);
+    const uptr expected_size = 9 * 2 + 90 * 3 + 900 * 4 + 9000 * 5 + 90000 * 6 + 7;
+    const string last = STR("99999\n100000\n");
+    TEST_ASSERT_TRUE(t, result.success);
+    TEST_ASSERT_EQUAL(t, bytesize(output, alloc.cursor), expected_size);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, byteoffset(alloc.cursor, -(iptr)bytesize(last.begin, last.end)), alloc.cursor, last.begin, last.end));
+    TEST_ASSERT_TRUE(t, stream.chunks > 1);
+    TEST_ASSERT_TRUE(t, stream.largest_chunk <= EXEC_COMMAND_CHUNK_SIZE);
+    sa_free(&alloc, output);
+
+    // Prefixes of the marker right before it, split over writes
+    stream = (stream_output){&alloc, 0, 0};
+    result = command_session_exec_command_stream(session, STRING("printf '__END_ ___EN'; sleep 0.05; printf 'D__'; sleep 0.05; printf '__'; exit_4() { return 4; }; exit_4"), stream_output_append, &stream);
+    const string expected = STR("__END_ ___END____");
+    TEST_ASSERT_EQUAL(t, result.exit_code, 4);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, output, alloc.cursor, expected.begin, expected.end));
+    sa_free(&alloc, output);
+
+    // The buffered path shares the matcher
+    result = command_session_exec_command(session, STRING("printf '_'; printf '__END__'"), &alloc);
+    const string buffered = STR("___END__");
+    TEST_ASSERT_TRUE(t, result.success);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, result.output, alloc.cursor, buffered.begin, buffered.end));
+    sa_free(&alloc, result.output);
+
+    close_persistent_shell(session);
+    sa_free(&alloc, session);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+// Hung commands are killed with what they started, the CPU time of finished ones is reported
+static void test_exec_command_timeout_usage(test_context* t) {
+    const uptr size = 4096;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+    exec_command_session* session = open_persistent_shell(&alloc);
+
+    exec_command_result result = command_session_exec_command_timeout(session, STRING("echo started; sleep 5"), 200, &alloc);
+    const string started = STR("started\n");
+    TEST_ASSERT_TRUE(t, result.timed_out);
+    TEST_ASSERT_FALSE(t, result.success);
+    TEST_ASSERT_TRUE(t, result.usage.wall_us >= 200000 && result.usage.wall_us < 1000000);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, result.output, alloc.cursor, started.begin, started.end));
+    TEST_ASSERT_EQUAL(t, result.usage.user_us + result.usage.system_us, 0);
+    sa_free(&alloc, result.output);
+
+    // The session runs commands again, a busy child shows in its CPU time
+    result = command_session_exec_command_timeout(session, STRING("sh -c 'i=0; while [ $i -lt 300000 ]; do i=$((i+1)); done'"), 10000, &alloc);
+    TEST_ASSERT_TRUE(t, result.success);
+    TEST_ASSERT_FALSE(t, result.timed_out);
+    TEST_ASSERT_TRUE(t, result.usage.user_us + result.usage.system_us > 0);
+    TEST_ASSERT_TRUE(t, result.usage.user_us + result.usage.system_us <= result.usage.wall_us + 20000);
+    sa_free(&alloc, result.output);
+
+    // One byte per read and write, mostly system time
+    result = command_session_exec_command_timeout(session, STRING("dd if=/dev/zero of=/dev/null bs=1 count=500000 2>/dev/null"), 10000, &alloc);
+    TEST_ASSERT_TRUE(t, result.success);
+    TEST_ASSERT_TRUE(t, result.usage.system_us > 0);
+    sa_free(&alloc, result.output);
+
+    const string sleep[] = {STR("sleep"), STR("5")};
+    result = exec_command_argv_timeout(sleep, sleep + 2, 100, &alloc);
+    TEST_ASSERT_TRUE(t, result.timed_out);
+    TEST_ASSERT_EQUAL(t, result.exit_code, -1);
+    TEST_ASSERT_TRUE(t, result.usage.wall_us < 1000000);
+    sa_free(&alloc, result.output);
+
+    const string busy[] = {STR("sh"), STR("-c"), STR("i=0; while [ $i -lt 300000 ]; do i=$((i+1)); done")};
+    result = exec_command_argv_timeout(busy, busy + 3, 10000, &alloc);
+    TEST_ASSERT_TRUE(t, result.success);
+    TEST_ASSERT_TRUE(t, result.usage.user_us > 0);
+    TEST_ASSERT_TRUE(t, result.usage.max_rss_kb > 0);
+    sa_free(&alloc, result.output);
+
+    result = exec_command_timeout(STRING("sleep 5"), 100, &alloc);
+    TEST_ASSERT_TRUE(t, result.timed_out);
+    TEST_ASSERT_TRUE(t, result.usage.wall_us < 1000000);
+    sa_free(&alloc, result.output);
+
+    close_persistent_shell(session);
+    sa_free(&alloc, session);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+// Running, not a zombie waiting for a parent that does not reap it
+static u8 exec_test_process_running(u64 pid) {
+    char path[32] = "/proc/";
+    char* path_end = convert_u64_to_decimal(pid, path + 6);
+    __builtin_memcpy(path_end, "/stat", 6);
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return 0;
+    }
+    char stat[256];
+    const ssize_t size = read(fd, stat, sizeof(stat));
+    close(fd);
+    const char* state = stat + size;
+    while (state > stat && state[-1] != ')') {
+        --state;
+    }
+    return size > 0 && state + 1 < stat + size && state[1] != 'Z';
+}
+
+// A terminating signal reaches the commands of the session shells
+static void test_exec_command_signal_forwarded(test_context* t) {
+    int pid_pipe[2];
+    TEST_ASSERT_EQUAL(t, pipe(pid_pipe), 0);
+    const pid_t child = fork();
+    if (child == 0) {
+        const uptr size = 4096;
+        void* memory = mem_map(size);
+        stack_alloc alloc;
+        sa_init(&alloc, memory, byteoffset(memory, size));
+        exec_command_session* session = open_persistent_shell(&alloc);
+        exec_command_result result = command_session_exec_command(session, STRING("sleep 5 >/dev/null 2>&1 & echo $!"), &alloc);
+        write(pid_pipe[1], result.output, bytesize(result.output, alloc.cursor));
+        raise(SIGTERM);
+        _exit(0);
+    }
+    close(pid_pipe[1]);
+    char text[32];
+    const ssize_t size = read(pid_pipe[0], text, sizeof(text));
+    close(pid_pipe[0]);
+    int status;
+    waitpid(child, &status, 0);
+    TEST_ASSERT_TRUE(t, WIFSIGNALED(status) && WTERMSIG(status) == SIGTERM);
+
+    u64 sleep_pid = 0;
+    for (ssize_t i = 0; i < size && text[i] >= '0' && text[i] <= '9'; ++i) {
+        sleep_pid = sleep_pid * 10 + (u64)(text[i] - '0');
+    }
+    TEST_ASSERT_TRUE(t, sleep_pid > 0);
+    u8 running = 1;
+    for (u32 i = 0; i < 1000 && running; ++i) {
+        running = exec_test_process_running(sleep_pid);
+        thread_current_sleep_until_us(sys_time_us() + 1000);
+    }
+    TEST_ASSERT_FALSE(t, running);
+}
+
 void test_exec_command_module(test_context* t) {
     REGISTER_TEST(t, "exec_command_ls_lists_files_on_multiple_lines", test_exec_command_ls_lists_files_on_multiple_lines);
+    REGISTER_TEST(t, "exec_command_argv", test_exec_command_argv);
+    REGISTER_TEST(t, "exec_command_stream", test_exec_command_stream);
+    REGISTER_TEST(t, "exec_command_timeout_usage", test_exec_command_timeout_usage);
+    REGISTER_TEST(t, "exec_command_signal_forwarded", test_exec_command_signal_forwarded);
+    REGISTER_TEST(t, "exec_command_pool_parallel", test_exec_command_pool_parallel);
+    REGISTER_TEST(t, "exec_command_pool_large_output", test_exec_command_pool_large_output);
 }
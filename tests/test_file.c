@@ -6,11 +6,21 @@
 #include "stack_alloc.h"
 #include "print.h"
 
+#include <sys/stat.h>
+#include <unistd.h>
+
 // Path definitions using STR
 static const string path_non_existent  = STR("test_temp/non_existent_file.txt");
 static const string path_test_output   = STR("test_temp/test_output.txt");
 static const string path_test_read_all = STR("test_temp/test_read_all.txt");
 static const string path_test_size     = STR("test_temp/test_size.txt");
+static const string path_test_map      = STR("test_temp/test_map.txt");
+static const string path_test_writer   = STR("test_temp/test_writer.txt");
+static const string path_test_stream   = STR("test_temp/test_stream.txt");
+static const string path_test_metadata = STR("test_temp/test_metadata.txt");
+static const string path_test_atomic   = STR("test_temp/test_atomic.txt");
+static const string path_test_vector   = STR("test_temp/test_vector.txt");
+static const string path_test_copy     = STR("test_temp/test_copy.txt");
 
 static void test_file_open_close(test_context* t) {
     // Set up temporary directory for tests
@@ -114,6 +124,467 @@ static void test_file_read_all(test_context* t) {
     cleanup_test_temp_dir();
 }
 
+static void test_file_map_readonly(test_context* t) {
+    // Set up temporary directory for tests
+    setup_test_temp_dir();
+
+    const string test_data = STR("Mapped file content.");
+
+    const uptr stack_size = 1024;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    // Empty file maps to an empty slice
+    file_t file = file_open(&alloc, path_test_map.begin, path_test_map.end, FILE_MODE_WRITE);
+    TEST_ASSERT_NOT_EQUAL(t, file, file_invalid());
+    file_close(file);
+
+    file = file_open(&alloc, path_test_map.begin, path_test_map.end, FILE_MODE_READ);
+    u8_slice mapping = file_map_readonly(file);
+    TEST_ASSERT_NULL(t, mapping.begin);
+    TEST_ASSERT_NULL(t, mapping.end);
+    file_unmap(mapping);
+    file_close(file);
+
+    file = file_open(&alloc, path_test_map.begin, path_test_map.end, FILE_MODE_WRITE);
+    file_write(file, test_data.begin, test_data.end);
+    file_close(file);
+
+    // The mapping outlives the file handle and does not use the allocator
+    file = file_open(&alloc, path_test_map.begin, path_test_map.end, FILE_MODE_READ);
+    mapping = file_map_readonly(file);
+    file_close(file);
+    TEST_ASSERT_EQUAL(t, bytesize(mapping.begin, mapping.end), bytesize(test_data.begin, test_data.end));
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, mapping.begin, mapping.end, test_data.begin, test_data.end));
+    TEST_ASSERT_EQUAL(t, alloc.cursor, alloc.begin);
+    file_unmap(mapping);
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    // Clean up temporary directory
+    cleanup_test_temp_dir();
+}
+
+static void test_file_writer(test_context* t) {
+    // Set up temporary directory for tests
+    setup_test_temp_dir();
+
+    const uptr stack_size = 1024;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    file_t file = file_open(&alloc, path_test_writer.begin, path_test_writer.end, FILE_MODE_WRITE);
+    TEST_ASSERT_NOT_EQUAL(t, file, file_invalid());
+
+    u8 buffer[8];
+    file_writer writer;
+    file_writer_init(&writer, file, buffer, byteoffset(buffer, sizeof(buffer)));
+
+    // Small writes stay in the buffer
+    const string first = STR("abc");
+    file_writer_write(&writer, first.begin, first.end);
+    TEST_ASSERT_EQUAL(t, file_size(file), 0);
+
+    // Data that does not fit is written along with the pending bytes
+    const string second = STR("defghijkl");
+    file_writer_write(&writer, second.begin, second.end);
+    TEST_ASSERT_EQUAL(t, file_size(file), 12);
+    TEST_ASSERT_EQUAL(t, writer.cursor, writer.begin);
+
+    const string third = STR("mn");
+    file_writer_write(&writer, third.begin, third.end);
+    file_writer_flush(&writer);
+    file_close(file);
+
+    const string expected = STR("abcdefghijklmn");
+    file = file_open(&alloc, path_test_writer.begin, path_test_writer.end, FILE_MODE_READ);
+    void* content;
+    uptr size = file_read_all(file, &content, &alloc);
+    TEST_ASSERT_EQUAL(t, size, bytesize(expected.begin, expected.end));
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, content, byteoffset(content, size), expected.begin, expected.end));
+    sa_free(&alloc, content);
+    file_close(file);
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    // Clean up temporary directory
+    cleanup_test_temp_dir();
+}
+
+static void file_stream_check(test_context* t, stack_alloc* alloc, file_stream_mode mode, uptr file_size, uptr chunk_size) {
+    file_t file = file_open(alloc, path_test_stream.begin, path_test_stream.end, FILE_MODE_READ);
+    TEST_ASSERT_NOT_EQUAL(t, file, file_invalid());
+
+    file_stream* stream = file_stream_init(alloc, file, chunk_size, mode);
+    uptr total = 0;
+    u8 content_matches = 1;
+    u8 sizes_match = 1;
+    for (u8_slice chunk = file_stream_next(stream); chunk.begin != chunk.end; chunk = file_stream_next(stream)) {
+        const uptr size = bytesize(chunk.begin, chunk.end);
+        if (size != chunk_size && total + size != file_size) {sizes_match = 0;}
+        for (uptr i = 0; i < size; ++i) {
+            if (chunk.begin[i] != (u8)((total + i) * 7)) {content_matches = 0;}
+        }
+        total += size;
+    }
+    TEST_ASSERT_EQUAL(t, total, file_size);
+    TEST_ASSERT_TRUE(t, content_matches);
+    TEST_ASSERT_TRUE(t, sizes_match);
+
+    // End of file is sticky
+    u8_slice end = file_stream_next(stream);
+    TEST_ASSERT_EQUAL(t, end.begin, end.end);
+
+    file_stream_deinit(alloc, stream);
+    file_close(file);
+}
+
+static void test_file_stream(test_context* t) {
+    // Set up temporary directory for tests
+    setup_test_temp_dir();
+
+    const uptr stack_size = 1024 * 16;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    // Empty file
+    file_t file = file_open(&alloc, path_test_stream.begin, path_test_stream.end, FILE_MODE_WRITE);
+    file_close(file);
+    file_stream_check(t, &alloc, FILE_STREAM_SYNC, 0, 64);
+    file_stream_check(t, &alloc, FILE_STREAM_BACKGROUND, 0, 64);
+
+    // File larger than the two chunks of the ring, last chunk partial
+    const uptr file_size = 10000;
+    u8* data = sa_alloc(&alloc, file_size);
+    for (uptr i = 0; i < file_size; ++i) {
+        data[i] = (u8)(i * 7);
+    }
+    file = file_open(&alloc, path_test_stream.begin, path_test_stream.end, FILE_MODE_WRITE);
+    file_write(file, data, data + file_size);
+    file_close(file);
+    sa_free(&alloc, data);
+
+    file_stream_check(t, &alloc, FILE_STREAM_SYNC, file_size, 1024);
+    file_stream_check(t, &alloc, FILE_STREAM_BACKGROUND, file_size, 1024);
+    file_stream_check(t, &alloc, FILE_STREAM_BACKGROUND, file_size, 1000);
+    TEST_ASSERT_EQUAL(t, alloc.cursor, alloc.begin);
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    // Clean up temporary directory
+    cleanup_test_temp_dir();
+}
+
+static void test_file_metadata(test_context* t) {
+    // Set up temporary directory for tests
+    setup_test_temp_dir();
+
+    const uptr stack_size = 1024;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    const string test_data = STR("metadata");
+    file_t file = file_open(&alloc, path_test_metadata.begin, path_test_metadata.end, FILE_MODE_WRITE);
+    file_write(file, test_data.begin, test_data.end);
+    const uptr modification_time = file_modification_time(file);
+    file_close(file);
+
+    const file_metadata metadata = file_metadata_path(&alloc, path_test_metadata);
+    TEST_ASSERT_TRUE(t, metadata.exists);
+    TEST_ASSERT_EQUAL(t, metadata.size, bytesize(test_data.begin, test_data.end));
+    TEST_ASSERT_EQUAL(t, metadata.modification_time, modification_time);
+    TEST_ASSERT_FALSE(t, file_metadata_path(&alloc, path_non_existent).exists);
+
+    // The cache keeps serving the first query until invalidated
+    file_metadata_cache* cache = file_metadata_cache_init(4);
+    TEST_ASSERT_EQUAL(t, file_metadata_cached(cache, path_test_metadata).size, bytesize(test_data.begin, test_data.end));
+    TEST_ASSERT_FALSE(t, file_metadata_cached(cache, path_non_existent).exists);
+
+    file = file_open(&alloc, path_test_metadata.begin, path_test_metadata.end, FILE_MODE_WRITE);
+    file_close(file);
+    TEST_ASSERT_EQUAL(t, file_metadata_cached(cache, path_test_metadata).size, bytesize(test_data.begin, test_data.end));
+    file_metadata_cache_invalidate(cache, path_test_metadata);
+    TEST_ASSERT_EQUAL(t, file_metadata_cached(cache, path_test_metadata).size, 0);
+    file_metadata_cache_deinit(cache);
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    // Clean up temporary directory
+    cleanup_test_temp_dir();
+}
+
+static void atomic_check_content(test_context* t, stack_alloc* alloc, string expected) {
+    file_t file = file_open(alloc, path_test_atomic.begin, path_test_atomic.end, FILE_MODE_READ);
+    TEST_ASSERT_NOT_EQUAL(t, file, file_invalid());
+    void* content;
+    const uptr size = file_read_all(file, &content, alloc);
+    TEST_ASSERT_EQUAL(t, size, bytesize(expected.begin, expected.end));
+    TEST_ASSERT_TRUE(t, sa_equals(alloc, content, byteoffset(content, size), expected.begin, expected.end));
+    sa_free(alloc, content);
+    file_close(file);
+}
+
+static void test_file_atomic(test_context* t) {
+    // Set up temporary directory for tests
+    setup_test_temp_dir();
+
+    const uptr stack_size = 4096;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    // Immediate commit creates the destination
+    const string first = STR("first");
+    file_atomic* atomic = file_atomic_open(&alloc, path_test_atomic.begin, path_test_atomic.end);
+    TEST_ASSERT_NOT_EQUAL(t, atomic, 0);
+    file_write(file_atomic_file(atomic), first.begin, first.end);
+    TEST_ASSERT_TRUE(t, file_atomic_commit(&alloc, atomic, 0));
+    atomic_check_content(t, &alloc, first);
+
+    // Aborting leaves the destination untouched
+    const string dropped = STR("dropped");
+    atomic = file_atomic_open(&alloc, path_test_atomic.begin, path_test_atomic.end);
+    file_write(file_atomic_file(atomic), dropped.begin, dropped.end);
+    file_atomic_abort(&alloc, atomic);
+    atomic_check_content(t, &alloc, first);
+
+    // Batched commit replaces the destination once the batch is flushed
+    const string second = STR("second content");
+    file_sync_batch batch;
+    file_sync_batch_init(&batch);
+    atomic = file_atomic_open(&alloc, path_test_atomic.begin, path_test_atomic.end);
+    file_write(file_atomic_file(atomic), second.begin, second.end);
+    TEST_ASSERT_TRUE(t, file_atomic_commit(&alloc, atomic, &batch));
+    TEST_ASSERT_EQUAL(t, batch.count, 1);
+    atomic_check_content(t, &alloc, first);
+    TEST_ASSERT_TRUE(t, file_sync_batch_commit(&batch));
+    TEST_ASSERT_EQUAL(t, batch.count, 0);
+    atomic_check_content(t, &alloc, second);
+
+    // A full batch commits by itself
+    char batched_path[] = "test_temp/test_atomic_0.txt";
+    const uptr digit = sizeof(batched_path) - sizeof("0.txt");
+    file_sync_batch_init(&batch);
+    for (u32 i = 0; i < FILE_SYNC_BATCH_MAX_RENAMES; ++i) {
+        batched_path[digit] = (char)('0' + i);
+        atomic = file_atomic_open(&alloc, (u8*)batched_path, (u8*)batched_path + sizeof(batched_path) - 1);
+        file_write(file_atomic_file(atomic), second.begin, second.end);
+        TEST_ASSERT_TRUE(t, file_atomic_commit(&alloc, atomic, &batch));
+    }
+    TEST_ASSERT_EQUAL(t, batch.pending, 0);
+    file_metadata_cache* cache = file_metadata_cache_init(FILE_SYNC_BATCH_MAX_RENAMES + 1);
+    const string last_batched = {batched_path, batched_path + sizeof(batched_path) - 1};
+    TEST_ASSERT_EQUAL(t, file_metadata_cached(cache, last_batched).size, bytesize(second.begin, second.end));
+    TEST_ASSERT_TRUE(t, file_sync_batch_commit(&batch));
+
+    // Only the temporary files of processes that exited are removed
+    const string stale = STR("test_temp/test_atomic.txt.2147483646.tmp");
+    file_close(file_open(&alloc, stale.begin, stale.end, FILE_MODE_WRITE));
+    atomic = file_atomic_open(&alloc, path_test_atomic.begin, path_test_atomic.end);
+    const string temp_directory = STR("test_temp");
+    file_atomic_cleanup(&alloc, temp_directory.begin, temp_directory.end);
+    TEST_ASSERT_FALSE(t, file_metadata_cached(cache, stale).exists);
+    file_metadata_cache_deinit(cache);
+    file_write(file_atomic_file(atomic), first.begin, first.end);
+    TEST_ASSERT_TRUE(t, file_atomic_commit(&alloc, atomic, 0));
+    atomic_check_content(t, &alloc, first);
+
+    TEST_ASSERT_EQUAL(t, alloc.cursor, memory);
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    // Clean up temporary directory
+    cleanup_test_temp_dir();
+}
+
+static void test_file_atomic_link_mode(test_context* t) {
+    // Set up temporary directory for tests
+    setup_test_temp_dir();
+
+    const uptr stack_size = 4096;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    // An executable reached through a symbolic link
+    const string first = STR("first");
+    file_t file = file_open(&alloc, path_test_atomic.begin, path_test_atomic.end, FILE_MODE_WRITE);
+    file_write(file, first.begin, first.end);
+    file_close(file);
+    chmod("test_temp/test_atomic.txt", 0750);
+    const string link = STR("test_temp/test_atomic_link");
+    symlink("test_atomic.txt", "test_temp/test_atomic_link");
+
+    const string second = STR("second");
+    file_atomic* atomic = file_atomic_open(&alloc, link.begin, link.end);
+    TEST_ASSERT_NOT_EQUAL(t, atomic, 0);
+    file_write(file_atomic_file(atomic), second.begin, second.end);
+    TEST_ASSERT_TRUE(t, file_atomic_commit(&alloc, atomic, 0));
+
+    struct stat st;
+    TEST_ASSERT_EQUAL(t, lstat("test_temp/test_atomic_link", &st), 0);
+    TEST_ASSERT_TRUE(t, S_ISLNK(st.st_mode));
+    TEST_ASSERT_EQUAL(t, stat("test_temp/test_atomic.txt", &st), 0);
+    TEST_ASSERT_EQUAL(t, st.st_mode & 07777, 0750);
+    atomic_check_content(t, &alloc, second);
+
+    TEST_ASSERT_EQUAL(t, alloc.cursor, memory);
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    // Clean up temporary directory
+    cleanup_test_temp_dir();
+}
+
+static void test_file_positional(test_context* t) {
+    // Set up temporary directory for tests
+    setup_test_temp_dir();
+
+    const uptr stack_size = 4096;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    file_t file = file_open(&alloc, path_test_vector.begin, path_test_vector.end, FILE_MODE_READ_WRITE);
+    TEST_ASSERT_NOT_EQUAL(t, file, file_invalid());
+
+    // Sequential gather write of a header and a payload
+    const string header = STR("HEAD");
+    const string payload = STR("payload");
+    const u8_slice parts[2] = {{(u8*)header.begin, (u8*)header.end}, {(u8*)payload.begin, (u8*)payload.end}};
+    TEST_ASSERT_EQUAL(t, file_write_vector(file, parts, parts + 2), 11);
+    TEST_ASSERT_EQUAL(t, file_size(file), 11);
+
+    // Positional writes leave the file position after the sequential write
+    const string patch = STR("LOAD");
+    TEST_ASSERT_EQUAL(t, file_write_at(file, patch.begin, patch.end, 7), 4);
+    const string tail = STR("!");
+    file_write(file, tail.begin, tail.end);
+
+    u8 read[12];
+    TEST_ASSERT_EQUAL(t, file_read_at(file, read, read + 12, 0), 12);
+    const string expected = STR("HEADpayLOAD!");
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, read, read + 12, expected.begin, expected.end));
+
+    // Reading past the end returns the available bytes only
+    TEST_ASSERT_EQUAL(t, file_read_at(file, read, read + 12, 8), 4);
+
+    // Scatter read over more slices than the FILE_VECTOR_BATCH (64) iovecs sent per syscall
+    u8 bytes[100];
+    u8_slice slices[100];
+    for (u32 i = 0; i < 100; ++i) {
+        bytes[i] = (u8)i;
+        slices[i] = (u8_slice){bytes + i, bytes + i + 1};
+    }
+    TEST_ASSERT_EQUAL(t, file_write_vector_at(file, slices, slices + 100, 12), 100);
+    __builtin_memset(bytes, 0xff, sizeof(bytes));
+    TEST_ASSERT_EQUAL(t, file_read_vector_at(file, slices, slices + 100, 12), 100);
+    u8 matches = 1;
+    for (u32 i = 0; i < 100; ++i) {
+        matches &= bytes[i] == (u8)i;
+    }
+    TEST_ASSERT_TRUE(t, matches);
+
+    file_close(file);
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    // Clean up temporary directory
+    cleanup_test_temp_dir();
+}
+
+static void test_file_copy_shorter(test_context* t) {
+    // Set up temporary directory for tests
+    setup_test_temp_dir();
+
+    const uptr stack_size = 64 * 1024;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    const u8 long_data[] = "the destination starts longer than the source";
+    const u8 short_data[] = "short";
+    file_t destination = file_open(&alloc, path_test_copy.begin, path_test_copy.end, FILE_MODE_WRITE);
+    file_write(destination, long_data, long_data + sizeof(long_data) - 1);
+    file_close(destination);
+    file_t source = file_open(&alloc, path_test_output.begin, path_test_output.end, FILE_MODE_WRITE);
+    file_write(source, short_data, short_data + sizeof(short_data) - 1);
+    file_close(source);
+
+    source = file_open(&alloc, path_test_output.begin, path_test_output.end, FILE_MODE_READ);
+    destination = file_open(&alloc, path_test_copy.begin, path_test_copy.end, FILE_MODE_READ_WRITE);
+    TEST_ASSERT_EQUAL(t, file_copy(destination, source), sizeof(short_data) - 1);
+    TEST_ASSERT_EQUAL(t, file_size(destination), sizeof(short_data) - 1);
+
+    void* copy;
+    const uptr copy_size = file_read_all(destination, &copy, &alloc);
+    TEST_ASSERT_EQUAL(t, copy_size, sizeof(short_data) - 1);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, copy, byteoffset(copy, copy_size), short_data, short_data + sizeof(short_data) - 1));
+    sa_free(&alloc, copy);
+
+    file_close(destination);
+    file_close(source);
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    // Clean up temporary directory
+    cleanup_test_temp_dir();
+}
+
+static void test_file_copy(test_context* t) {
+    // Set up temporary directory for tests
+    setup_test_temp_dir();
+
+    // Larger than the buffer of the read/write fallback
+    const uptr data_size = 200 * 1024;
+    const uptr stack_size = data_size * 2 + 1024;
+    void* memory = mem_map(stack_size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, stack_size));
+
+    u8* data = sa_alloc(&alloc, data_size);
+    for (uptr i = 0; i < data_size; ++i) {
+        data[i] = (u8)(i * 31);
+    }
+    file_t source = file_open(&alloc, path_test_output.begin, path_test_output.end, FILE_MODE_WRITE);
+    file_write(source, data, data + data_size);
+    file_close(source);
+
+    // The destination is longer than the source and must be truncated
+    file_t destination = file_open(&alloc, path_test_copy.begin, path_test_copy.end, FILE_MODE_WRITE);
+    file_write(destination, data, data + data_size);
+    file_write(destination, data, data + 16);
+    file_close(destination);
+
+    source = file_open(&alloc, path_test_output.begin, path_test_output.end, FILE_MODE_READ);
+    destination = file_open(&alloc, path_test_copy.begin, path_test_copy.end, FILE_MODE_READ_WRITE);
+    TEST_ASSERT_EQUAL(t, file_copy(destination, source), data_size);
+    TEST_ASSERT_EQUAL(t, file_size(destination), data_size);
+
+    void* copy;
+    const uptr copy_size = file_read_all(destination, &copy, &alloc);
+    TEST_ASSERT_EQUAL(t, copy_size, data_size);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, copy, byteoffset(copy, copy_size), data, data + data_size));
+    sa_free(&alloc, copy);
+
+    file_close(destination);
+    file_close(source);
+    sa_free(&alloc, data);
+    sa_deinit(&alloc);
+    mem_unmap(memory, stack_size);
+
+    // Clean up temporary directory
+    cleanup_test_temp_dir();
+}
+
 static void test_file_size(test_context* t) {
     // Set up temporary directory for tests
     setup_test_temp_dir();
@@ -154,4 +625,13 @@ void test_file_module(test_context* t) {
     REGISTER_TEST(t, "file_write_read", test_file_write_read);
     REGISTER_TEST(t, "file_read_all", test_file_read_all);
     REGISTER_TEST(t, "file_size", test_file_size);
+    REGISTER_TEST(t, "file_map_readonly", test_file_map_readonly);
+    REGISTER_TEST(t, "file_writer", test_file_writer);
+    REGISTER_TEST(t, "file_stream", test_file_stream);
+    REGISTER_TEST(t, "file_metadata", test_file_metadata);
+    REGISTER_TEST(t, "file_atomic", test_file_atomic);
+    REGISTER_TEST(t, "file_atomic_link_mode", test_file_atomic_link_mode);
+    REGISTER_TEST(t, "file_positional", test_file_positional);
+    REGISTER_TEST(t, "file_copy", test_file_copy);
+    REGISTER_TEST(t, "file_copy_shorter", test_file_copy_shorter);
 }
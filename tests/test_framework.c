@@ -1,6 +1,7 @@
 #include "test_framework.h"
 #include "print.h"
 #include "file.h"
+#include "log.h"
 
 test_context* test_context_init(stack_alloc* alloc) {
     test_context* t = sa_alloc(alloc, sizeof(*t));
@@ -14,22 +15,33 @@ test_context* test_context_init(stack_alloc* alloc) {
 }
 
 void test_report_context(test_context* t) {
-    print_string(file_stdout(), STRING("Test Results:\n"));
+    u8 buffer[512];
+    file_writer writer;
+    file_writer_init(&writer, file_stdout(), buffer, byteoffset(buffer, sizeof(buffer)));
+
+    print_string_to_writer(&writer, STRING("Test Results:\n"));
     if (t->filter_pattern.begin) {
-        print_format(file_stdout(), STRING("  Filter: %s\n"), t->filter_pattern);
+        print_format_to_writer(&writer, STRING("  Filter: %s\n"), t->filter_pattern);
     }
-    print_format(file_stdout(), STRING("  Passed: %u\n"), t->passed);
-    print_format(file_stdout(), STRING("  Failed: %u\n"), t->failed);
-    print_format(file_stdout(), STRING("  Total: %u\n"), t->passed + t->failed);
+    print_format_to_writer(&writer, STRING("  Passed: %u\n"), t->passed);
+    print_format_to_writer(&writer, STRING("  Failed: %u\n"), t->failed);
+    print_format_to_writer(&writer, STRING("  Total: %u\n"), t->passed + t->failed);
+    file_writer_flush(&writer);
 }
 
 void test_register(test_context* t, const string name, void (*func)(test_context* t)) {
     test_context_entry* test = sa_alloc(t->alloc, sizeof(*test));
     test->name = name;
     test->func = func;
+    test->benchmark = 0;
     t->test_count++;
 }
 
+void test_register_benchmark(test_context* t, const string name, void (*func)(test_context* t)) {
+    test_register(t, name, func);
+    t->entries[t->test_count - 1].benchmark = 1;
+}
+
 static int test_matches_filter(const string test_name, const string pattern) {
     const char* name_ptr = test_name.begin;
     const char* pattern_ptr = pattern.begin;
@@ -51,15 +63,14 @@ void test_run_filtered(test_context* t) {
 
     test_context_entry* test = t->entries;
     while ((void*)test < t->alloc->cursor) {
-        int matches = (!t->filter_pattern.begin) ||
-                      test_matches_filter(test->name, t->filter_pattern);
+        int matches = t->filter_pattern.begin ? test_matches_filter(test->name, t->filter_pattern) : !test->benchmark;
 
         if (matches) {
-            print_format(file_stdout(), STRING("Running test: %s\n"), test->name);
+            LOG_INFO(STRING("Running test: %s"), test->name);
             test->func(t);
             run_count++;
         } else {
-            print_format(file_stdout(), STRING("Skipping test: %s\n"), test->name);
+            LOG_DEBUG(STRING("Skipping test: %s"), test->name);
             skipped_count++;
         }
 
@@ -67,6 +78,6 @@ void test_run_filtered(test_context* t) {
     }
 
     if (t->filter_pattern.begin) {
-        print_format(file_stdout(), STRING("Tests run: %u, skipped: %u\n"), run_count, skipped_count);
+        PRINT_FORMAT(file_stdout(), STRING("Tests run: %u, skipped: %u\n"), run_count, skipped_count);
     }
 }
@@ -11,6 +11,7 @@ typedef struct test_context test_context;
 typedef struct test_context_entry {
     void (*func)(struct test_context* t);
     string name;
+    u8 benchmark;
 } test_context_entry;
 
 struct test_context {
@@ -26,6 +27,8 @@ struct test_context {
 test_context* test_context_init(stack_alloc* alloc);
 void test_report_context(test_context* t);
 void test_register(test_context* t, const string name, void (*func)(test_context* t));
+// Benchmarks are left out of the default run, they only run when the filter matches them
+void test_register_benchmark(test_context* t, const string name, void (*func)(test_context* t));
 void test_run_filtered(test_context* t);
 
 // Test macros using context
@@ -47,5 +50,7 @@ void test_run_filtered(test_context* t);
 
 // Test registration macro
 #define REGISTER_TEST(ctx, name, func) test_register(ctx, STRING(name), func)
+// Benchmark names start with "bench_", --filter bench runs all of them
+#define REGISTER_BENCHMARK(ctx, name, func) test_register_benchmark(ctx, STRING("bench_" name), func)
 
 #endif /* TEST_FRAMEWORK_H */
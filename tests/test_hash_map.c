@@ -0,0 +1,133 @@
+// Tests for hash map module
+#include "test_hash_map.h"
+#include "hash_map.h"
+#include "mem.h"
+#include "print.h"
+#include "file.h"
+
+static void test_hash_map_string_keys(test_context* t) {
+    uptr size = 4096;
+    void* mem = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, mem, byteoffset(mem, size));
+
+    hash_map* map = hash_map_init(&alloc, HASH_MAP_KEY_STRING, 8);
+    TEST_ASSERT_EQUAL(t, hash_map_count(map), 0);
+    TEST_ASSERT_NULL(t, hash_map_find_string(map, STRING("build/a.o")));
+
+    u8 inserted = 0;
+    uptr* a = hash_map_insert_string(map, STRING("build/a.o"), &inserted);
+    TEST_ASSERT_NOT_NULL(t, a);
+    TEST_ASSERT_TRUE(t, inserted);
+    TEST_ASSERT_EQUAL(t, *a, 0);
+    *a = 1;
+
+    uptr* b = hash_map_insert_string(map, STRING("build/b.o"), &inserted);
+    TEST_ASSERT_TRUE(t, inserted);
+    *b = 2;
+
+    // Inserting an existing key returns the existing value
+    a = hash_map_insert_string(map, STRING("build/a.o"), &inserted);
+    TEST_ASSERT_FALSE(t, inserted);
+    TEST_ASSERT_EQUAL(t, *a, 1);
+    TEST_ASSERT_EQUAL(t, hash_map_count(map), 2);
+
+    // Keys are compared by content, not by address
+    const char key[] = "build/b.o";
+    uptr* found = hash_map_find_string(map, (string){key, byteoffset(key, sizeof(key) - 1)});
+    TEST_ASSERT_NOT_NULL(t, found);
+    TEST_ASSERT_EQUAL(t, *found, 2);
+
+    // Prefix of an existing key is a different key
+    TEST_ASSERT_NULL(t, hash_map_find_string(map, STRING("build/b")));
+
+    TEST_ASSERT_TRUE(t, hash_map_remove_string(map, STRING("build/a.o")));
+    TEST_ASSERT_FALSE(t, hash_map_remove_string(map, STRING("build/a.o")));
+    TEST_ASSERT_NULL(t, hash_map_find_string(map, STRING("build/a.o")));
+    TEST_ASSERT_EQUAL(t, hash_map_count(map), 1);
+
+    hash_map_deinit(&alloc, map);
+    TEST_ASSERT_TRUE(t, alloc.cursor == alloc.begin);
+
+    sa_deinit(&alloc);
+    mem_unmap(mem, size);
+}
+
+static void test_hash_map_u64_many_keys(test_context* t) {
+    uptr size = 64 * 1024;
+    void* mem = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, mem, byteoffset(mem, size));
+
+    const uptr count = 1000;
+    hash_map* map = hash_map_init(&alloc, HASH_MAP_KEY_U64, count);
+
+    // Keys sharing low bits to stress the probing
+    u8 all_inserted = 1;
+    for (u64 i = 0; i < count; ++i) {
+        uptr* value = hash_map_insert_u64(map, i << 20, 0);
+        if (!value) {all_inserted = 0; break;}
+        *value = (uptr)i;
+    }
+    TEST_ASSERT_TRUE(t, all_inserted);
+    TEST_ASSERT_EQUAL(t, hash_map_count(map), count);
+
+    u8 all_found = 1;
+    for (u64 i = 0; i < count; ++i) {
+        uptr* value = hash_map_find_u64(map, i << 20);
+        if (!value || *value != (uptr)i) {all_found = 0;}
+    }
+    TEST_ASSERT_TRUE(t, all_found);
+    TEST_ASSERT_NULL(t, hash_map_find_u64(map, 1));
+
+    // Remove the even keys, odd keys are still reachable through the tombstones
+    for (u64 i = 0; i < count; i += 2) {
+        hash_map_remove_u64(map, i << 20);
+    }
+    TEST_ASSERT_EQUAL(t, hash_map_count(map), count / 2);
+    u8 odd_found = 1;
+    for (u64 i = 1; i < count; i += 2) {
+        if (!hash_map_find_u64(map, i << 20)) {odd_found = 0;}
+    }
+    TEST_ASSERT_TRUE(t, odd_found);
+    TEST_ASSERT_NULL(t, hash_map_find_u64(map, 2 << 20));
+
+    hash_map_clear(map);
+    TEST_ASSERT_EQUAL(t, hash_map_count(map), 0);
+    TEST_ASSERT_NULL(t, hash_map_find_u64(map, 1 << 20));
+
+    hash_map_deinit(&alloc, map);
+    sa_deinit(&alloc);
+    mem_unmap(mem, size);
+}
+
+static void test_hash_map_full(test_context* t) {
+    uptr size = 4096;
+    void* mem = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, mem, byteoffset(mem, size));
+
+    // A single group of 16 slots accepts 14 entries (7/8 load factor)
+    hash_map* map = hash_map_init(&alloc, HASH_MAP_KEY_U64, 14);
+    uptr accepted = 0;
+    for (u64 i = 0; i < 32; ++i) {
+        if (hash_map_insert_u64(map, i, 0)) {++accepted;}
+    }
+    TEST_ASSERT_EQUAL(t, accepted, 14);
+    TEST_ASSERT_EQUAL(t, hash_map_count(map), 14);
+
+    // Removing makes room again
+    TEST_ASSERT_TRUE(t, hash_map_remove_u64(map, 3));
+    TEST_ASSERT_NOT_NULL(t, hash_map_insert_u64(map, 100, 0));
+
+    hash_map_deinit(&alloc, map);
+    sa_deinit(&alloc);
+    mem_unmap(mem, size);
+}
+
+void test_hash_map_module(test_context* t) {
+    print_string(file_stdout(), STRING("Registering Hash Map Module Tests...\n"));
+    REGISTER_TEST(t, "hash_map_string_keys", test_hash_map_string_keys);
+    REGISTER_TEST(t, "hash_map_u64_many_keys", test_hash_map_u64_many_keys);
+    REGISTER_TEST(t, "hash_map_full", test_hash_map_full);
+}
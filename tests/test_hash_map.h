@@ -0,0 +1,9 @@
+#ifndef TEST_HASH_MAP_H
+#define TEST_HASH_MAP_H
+
+#include "test_framework.h"
+
+// Declaration of hash map module test function
+void test_hash_map_module(test_context* t);
+
+#endif /* TEST_HASH_MAP_H */
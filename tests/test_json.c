@@ -0,0 +1,241 @@
+// Tests for json module
+#include "test_json.h"
+#include "json.h"
+#include "mem.h"
+#include "print.h"
+
+static u8 token_is(json_token token, json_token_type type, string text) {
+    return token.type == type
+        && bytesize(token.text.begin, token.text.end) == bytesize(text.begin, text.end)
+        && __builtin_memcmp(token.text.begin, text.begin, bytesize(text.begin, text.end)) == 0;
+}
+
+// Tokenize the whole document, returns the last token (end or error)
+static json_token tokenize_all(string document) {
+    json_tokenizer t;
+    json_tokenizer_init(&t, document.begin, document.end);
+    json_token token;
+    do {
+        token = json_next(&t);
+    } while (token.type != JSON_TOKEN_END && token.type != JSON_TOKEN_ERROR);
+    return token;
+}
+
+static void test_json_tokenize(test_context* t) {
+    const string document = STR("{\"a\": [1, -2.5e3, true, false, null],\n \"b\" : {\"c\": \"x\\\"y\"}, \"d\": []}");
+    json_tokenizer tokenizer;
+    json_tokenizer_init(&tokenizer, document.begin, document.end);
+
+    const struct {json_token_type type; string text;} expected[] = {
+        {JSON_TOKEN_OBJECT_BEGIN, STR("{")},
+        {JSON_TOKEN_KEY, STR("a")},
+        {JSON_TOKEN_ARRAY_BEGIN, STR("[")},
+        {JSON_TOKEN_NUMBER, STR("1")},
+        {JSON_TOKEN_NUMBER, STR("-2.5e3")},
+        {JSON_TOKEN_TRUE, STR("true")},
+        {JSON_TOKEN_FALSE, STR("false")},
+        {JSON_TOKEN_NULL, STR("null")},
+        {JSON_TOKEN_ARRAY_END, STR("]")},
+        {JSON_TOKEN_KEY, STR("b")},
+        {JSON_TOKEN_OBJECT_BEGIN, STR("{")},
+        {JSON_TOKEN_KEY, STR("c")},
+        {JSON_TOKEN_STRING, STR("x\\\"y")},
+        {JSON_TOKEN_OBJECT_END, STR("}")},
+        {JSON_TOKEN_KEY, STR("d")},
+        {JSON_TOKEN_ARRAY_BEGIN, STR("[")},
+        {JSON_TOKEN_ARRAY_END, STR("]")},
+        {JSON_TOKEN_OBJECT_END, STR("}")},
+        {JSON_TOKEN_END, STR("")},
+    };
+    u8 all_match = 1;
+    for (uptr i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i) {
+        all_match &= token_is(json_next(&tokenizer), expected[i].type, expected[i].text);
+    }
+    TEST_ASSERT_TRUE(t, all_match);
+
+    // Scalars are documents too
+    TEST_ASSERT_EQUAL(t, tokenize_all(STRING(" \"alone\" ")).type, JSON_TOKEN_END);
+    TEST_ASSERT_EQUAL(t, tokenize_all(STRING("-0.0E+1")).type, JSON_TOKEN_END);
+}
+
+static void test_json_invalid(test_context* t) {
+    const string documents[] = {
+        STR(""),
+        STR("{"),
+        STR("[1,]"),
+        STR("{\"a\" 1}"),
+        STR("{\"a\":1,}"),
+        STR("{1:2}"),
+        STR("01"),
+        STR("1."),
+        STR("-"),
+        STR("tru"),
+        STR("[1] 2"),
+        STR("[1}"),
+        STR("\"abc"),
+        STR("\"a\\q\""),
+        STR("\"\\u12g4\""),
+        STR("\"tab\tinside\""),
+    };
+    u8 all_failed = 1;
+    for (uptr i = 0; i < sizeof(documents) / sizeof(documents[0]); ++i) {
+        all_failed &= tokenize_all(documents[i]).type == JSON_TOKEN_ERROR;
+    }
+    TEST_ASSERT_TRUE(t, all_failed);
+
+    // Nesting is limited to JSON_MAX_DEPTH
+    char nested[2 * (JSON_MAX_DEPTH + 1)];
+    for (u32 i = 0; i <= JSON_MAX_DEPTH; ++i) {
+        nested[i] = '[';
+        nested[2 * JSON_MAX_DEPTH + 1 - i] = ']';
+    }
+    TEST_ASSERT_EQUAL(t, tokenize_all((string){nested, nested + sizeof(nested)}).type, JSON_TOKEN_ERROR);
+    TEST_ASSERT_EQUAL(t, tokenize_all((string){nested + 1, nested + sizeof(nested) - 1}).type, JSON_TOKEN_END);
+}
+
+static void test_json_find(test_context* t) {
+    const string document = STR("{\"skip\": {\"id\": [1, {\"id\": 2}]}, \"id\": \"found\", \"after\": 3}");
+    json_tokenizer tokenizer;
+    json_tokenizer_init(&tokenizer, document.begin, document.end);
+    TEST_ASSERT_EQUAL(t, json_next(&tokenizer).type, JSON_TOKEN_OBJECT_BEGIN);
+    TEST_ASSERT_TRUE(t, token_is(json_object_find(&tokenizer, STRING("id")), JSON_TOKEN_STRING, STRING("found")));
+    TEST_ASSERT_EQUAL(t, json_object_find(&tokenizer, STRING("missing")).type, JSON_TOKEN_OBJECT_END);
+    TEST_ASSERT_EQUAL(t, json_next(&tokenizer).type, JSON_TOKEN_END);
+
+    // Skipping a container leaves the tokenizer after it
+    json_tokenizer_init(&tokenizer, document.begin, document.end);
+    json_token token = json_skip(&tokenizer, json_next(&tokenizer));
+    TEST_ASSERT_EQUAL(t, token.type, JSON_TOKEN_OBJECT_END);
+    TEST_ASSERT_EQUAL(t, json_next(&tokenizer).type, JSON_TOKEN_END);
+}
+
+static void test_json_unescape(test_context* t) {
+    uptr size = 1024;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    // Simple escapes, 2 and 4 byte UTF-8 (the latter from a surrogate pair) and an unpaired surrogate
+    const string text = STR("a\\n\\/\\u00e9\\ud83d\\ude00\\ud800x\\\\");
+    u8* begin = json_unescape(&alloc, text);
+    const u8 expected[] = {'a', '\n', '/', 0xC3, 0xA9, 0xF0, 0x9F, 0x98, 0x80, 0xEF, 0xBF, 0xBD, 'x', '\\'};
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, begin, alloc.cursor, expected, expected + sizeof(expected)));
+    sa_free(&alloc, begin);
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+static void test_json_write_string(test_context* t) {
+    uptr size = 4096;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    // Specials past the first 16 bytes go through the vector scan
+    u8* begin = json_write_string(&alloc, STRING("plain text long enough \"quoted\"\n\ttab\\\x01 caf\xC3\xA9"));
+    const string expected = STR("\"plain text long enough \\\"quoted\\\"\\n\\ttab\\\\\\u0001 caf\xC3\xA9\"");
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, begin, alloc.cursor, expected.begin, expected.end));
+    sa_free(&alloc, begin);
+
+    // Every byte value survives a write, tokenize and unescape round trip
+    u8 bytes[255];
+    for (u32 i = 0; i < sizeof(bytes); ++i) {
+        bytes[i] = (u8)(i + 1);
+    }
+    begin = json_write_string(&alloc, (string){bytes, bytes + sizeof(bytes)});
+    json_tokenizer tokenizer;
+    json_tokenizer_init(&tokenizer, begin, alloc.cursor);
+    json_token token = json_next(&tokenizer);
+    TEST_ASSERT_EQUAL(t, token.type, JSON_TOKEN_STRING);
+    TEST_ASSERT_EQUAL(t, json_next(&tokenizer).type, JSON_TOKEN_END);
+    u8* decoded = json_unescape(&alloc, token.text);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, decoded, alloc.cursor, bytes, bytes + sizeof(bytes)));
+    sa_free(&alloc, begin);
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+typedef struct {
+    i32* begin;
+    i32* end;
+} i32_array_t;
+
+static const meta i32_array_meta = {
+    .type_size = sizeof(i32_array_t),
+    .pt = PT_ARRAY,
+    .array_element_meta = &i32_meta
+};
+
+typedef struct {
+    string name;
+    i32_array_t values;
+} item_t;
+
+static const field_descriptor item_fields[] = {
+    {STR("name"), offsetof(item_t, name), &string_meta},
+    {STR("values"), offsetof(item_t, values), &i32_array_meta},
+};
+
+static const meta item_meta = {
+    .type_name = STR("item_t"),
+    .type_size = sizeof(item_t),
+    .pt = PT_NONE,
+    .fields = {RANGE(item_fields)},
+};
+
+typedef struct {
+    u64 id;
+    i8 delta;
+    f64 ratio;
+    f64 missing;
+    item_t item;
+} record_t;
+
+static const field_descriptor record_fields[] = {
+    {STR("id"), offsetof(record_t, id), &u64_meta},
+    {STR("delta"), offsetof(record_t, delta), &i8_meta},
+    {STR("ratio"), offsetof(record_t, ratio), &f64_meta},
+    {STR("missing"), offsetof(record_t, missing), &f64_meta},
+    {STR("item"), offsetof(record_t, item), &item_meta},
+};
+
+static const meta record_meta = {
+    .type_name = STR("record_t"),
+    .type_size = sizeof(record_t),
+    .pt = PT_NONE,
+    .fields = {RANGE(record_fields)},
+};
+
+static void test_json_encode(test_context* t) {
+    uptr size = 1024;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    i32 values[] = {3, -4};
+    record_t record = {18446744073709551615ull, -7, 0.25, __builtin_nan(""), {STR("a \"b\""), {values, values + 2}}};
+    u8* begin = json_encode(&alloc, &record_meta, &record);
+    const string expected = STR("{\"id\":18446744073709551615,\"delta\":-7,\"ratio\":0.25,\"missing\":null,\"item\":{\"name\":\"a \\\"b\\\"\",\"values\":[3,-4]}}");
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, begin, alloc.cursor, expected.begin, expected.end));
+
+    // The output parses back
+    json_tokenizer tokenizer;
+    json_tokenizer_init(&tokenizer, begin, alloc.cursor);
+    TEST_ASSERT_EQUAL(t, json_next(&tokenizer).type, JSON_TOKEN_OBJECT_BEGIN);
+    TEST_ASSERT_TRUE(t, token_is(json_object_find(&tokenizer, STRING("ratio")), JSON_TOKEN_NUMBER, STRING("0.25")));
+    sa_free(&alloc, begin);
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+void test_json_module(test_context* t) {
+    REGISTER_TEST(t, "json_tokenize", test_json_tokenize);
+    REGISTER_TEST(t, "json_invalid", test_json_invalid);
+    REGISTER_TEST(t, "json_find", test_json_find);
+    REGISTER_TEST(t, "json_unescape", test_json_unescape);
+    REGISTER_TEST(t, "json_write_string", test_json_write_string);
+    REGISTER_TEST(t, "json_encode", test_json_encode);
+}
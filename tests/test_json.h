@@ -0,0 +1,9 @@
+#ifndef TEST_JSON_H
+#define TEST_JSON_H
+
+#include "test_framework.h"
+
+// Declaration of json module test function
+void test_json_module(test_context* t);
+
+#endif /* TEST_JSON_H */
@@ -0,0 +1,205 @@
+// Tests for log module
+#include "test_log.h"
+#include "test_temp_dir.h"
+#include "log.h"
+#include "meta.h"
+#include "mem.h"
+#include "print.h"
+#include "system_time.h"
+
+#include <pthread.h>
+
+static const string path_log = STR("test_temp/log.txt");
+
+#define LOG_TEST_THREADS 4
+#define LOG_TEST_RECORDS 2000
+
+static void* log_test_worker(void* arg) {
+    const u32 worker = (u32)(uptr)arg;
+    for (u32 i = 0; i < LOG_TEST_RECORDS; ++i) {
+        LOG_INFO(STRING("worker %u record %u %s"), worker, i, STRING("payload"));
+    }
+    return 0;
+}
+
+// Parse the decimal number at text, advancing it
+static u32 log_test_number(const char** text, const char* end) {
+    u32 value = 0;
+    for (; *text != end && **text >= '0' && **text <= '9'; ++*text) {
+        value = value * 10 + (u32)(**text - '0');
+    }
+    return value;
+}
+
+// Records of several threads, more than a ring holds, come out complete and in order per thread
+static void test_log_threads(test_context* t) {
+    setup_test_temp_dir();
+    const uptr size = 1024 * 1024;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    file_t file = file_open(&alloc, path_log.begin, path_log.end, FILE_MODE_WRITE);
+    TEST_ASSERT_NOT_EQUAL(t, file, file_invalid());
+    log_start(file);
+    pthread_t threads[LOG_TEST_THREADS - 1];
+    for (u32 i = 1; i < LOG_TEST_THREADS; ++i) {
+        pthread_create(&threads[i - 1], 0, log_test_worker, (void*)(uptr)i);
+    }
+    log_test_worker(0);
+    for (u32 i = 1; i < LOG_TEST_THREADS; ++i) {
+        pthread_join(threads[i - 1], 0);
+    }
+    log_stop();
+    file_close(file);
+
+    file = file_open(&alloc, path_log.begin, path_log.end, FILE_MODE_READ);
+    void* buffer;
+    const uptr length = file_read_all(file, &buffer, &alloc);
+    file_close(file);
+
+    u32 next[LOG_TEST_THREADS] = {0};
+    u8 in_order = 1;
+    const string marker = STR("INFO  worker ");
+    const string separator = STR(" record ");
+    const char* cursor = buffer;
+    const char* end = byteoffset(buffer, length);
+    while ((cursor = sa_find(&alloc, cursor, end, marker.begin, marker.end)) != 0) {
+        cursor += bytesize(marker.begin, marker.end);
+        const u32 worker = log_test_number(&cursor, end);
+        cursor += bytesize(separator.begin, separator.end);
+        const u32 record = log_test_number(&cursor, end);
+        in_order &= worker < LOG_TEST_THREADS && record == next[worker];
+        if (worker < LOG_TEST_THREADS) {
+            next[worker] += 1;
+        }
+    }
+    TEST_ASSERT_TRUE(t, in_order);
+    for (u32 i = 0; i < LOG_TEST_THREADS; ++i) {
+        TEST_ASSERT_EQUAL(t, next[i], LOG_TEST_RECORDS);
+    }
+
+    sa_free(&alloc, buffer);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+    cleanup_test_temp_dir();
+}
+
+typedef struct {
+    i32 x;
+    i32 y;
+} log_point_t;
+
+static const field_descriptor log_point_fields[] = {
+    {STR("x"), offsetof(log_point_t, x), &i32_meta},
+    {STR("y"), offsetof(log_point_t, y), &i32_meta},
+};
+
+static const meta log_point_meta = {
+    .type_name = STR("log_point_t"),
+    .type_size = sizeof(log_point_t),
+    .pt = PT_NONE,
+    .fields = {RANGE(log_point_fields)},
+};
+
+// Levels, argument capture and records written on the calling thread
+static void test_log_levels(test_context* t) {
+    setup_test_temp_dir();
+    const uptr size = 256 * 1024;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    file_t file = file_open(&alloc, path_log.begin, path_log.end, FILE_MODE_WRITE);
+    log_start(file);
+
+    log_set_level(LOG_LEVEL_WARN);
+    LOG_INFO(STRING("hidden"));
+    LOG_WARN(STRING("shown %-4d|%5s|%g"), 7, STRING("ab"), 0.5);
+    log_set_level(LOG_LEVEL_INFO);
+
+    // Arguments are copied, they can change right after the call
+    log_point_t point = {1, 2};
+    char name[] = "first";
+    LOG_ERROR(STRING("%m %s"), &log_point_meta, &point, (string){name, name + 5});
+    point.x = 3;
+    name[0] = 'F';
+
+    // Larger than a record, written after the pending ones
+    const uptr large_size = LOG_RECORD_MAX + 1;
+    char* large = sa_alloc(&alloc, large_size);
+    __builtin_memset(large, 'z', large_size);
+    LOG_INFO(STRING("large %s"), (string){large, large + large_size});
+    LOG_INFO(STRING("last"));
+    log_stop();
+    file_close(file);
+
+    file = file_open(&alloc, path_log.begin, path_log.end, FILE_MODE_READ);
+    void* buffer;
+    const uptr length = file_read_all(file, &buffer, &alloc);
+    file_close(file);
+    const char* end = byteoffset(buffer, length);
+
+    const string hidden = STR("hidden");
+    const string shown = STR("WARN  shown 7   |   ab|0.5\n");
+    const string captured = STR("ERROR log_point_t {x: 1, y: 2} first\n");
+    const string last = STR("INFO  last\n");
+    TEST_ASSERT_FALSE(t, sa_contains(&alloc, buffer, end, hidden.begin, hidden.end));
+    const char* shown_at = sa_find(&alloc, buffer, end, shown.begin, shown.end);
+    const char* captured_at = sa_find(&alloc, buffer, end, captured.begin, captured.end);
+    const char* large_at = sa_find(&alloc, buffer, end, large, large + large_size);
+    const char* last_at = sa_find(&alloc, buffer, end, last.begin, last.end);
+    TEST_ASSERT_TRUE(t, shown_at != 0 && captured_at > shown_at && large_at > captured_at && last_at > large_at);
+
+    sa_free(&alloc, large);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+    cleanup_test_temp_dir();
+}
+
+// Cost of a call site filtered at runtime and of an appended record, timings are reported but not asserted
+static void test_log_benchmark(test_context* t) {
+    setup_test_temp_dir();
+    const uptr size = 1024;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    file_t file = file_open(&alloc, path_log.begin, path_log.end, FILE_MODE_WRITE);
+    log_start(file);
+
+    const u32 iterations = 200000;
+    // Shortest line of the appended records
+    const uptr separator_size = 30;
+    log_set_level(LOG_LEVEL_WARN);
+    u64 begin_us = sys_time_us();
+    for (u32 i = 0; i < iterations; ++i) {
+        LOG_INFO(STRING("filtered %u"), i);
+    }
+    const u64 filtered_us = sys_time_us() - begin_us;
+    log_set_level(LOG_LEVEL_INFO);
+
+    begin_us = sys_time_us();
+    for (u32 i = 0; i < iterations; ++i) {
+        LOG_INFO(STRING("record %u of %s"), i, STRING("benchmark"));
+    }
+    const u64 appended_us = sys_time_us() - begin_us;
+    log_stop();
+    file_close(file);
+
+    file = file_open(&alloc, path_log.begin, path_log.end, FILE_MODE_READ);
+    TEST_ASSERT_TRUE(t, file_size(file) > iterations * separator_size);
+    file_close(file);
+    print_format(file_stdout(), STRING("log: %llums for %u filtered calls, %llums for %u records\n"),
+        filtered_us / 1000, iterations, appended_us / 1000, iterations);
+
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+    cleanup_test_temp_dir();
+}
+
+void test_log_module(test_context* t) {
+    REGISTER_TEST(t, "log_threads", test_log_threads);
+    REGISTER_TEST(t, "log_levels", test_log_levels);
+    REGISTER_BENCHMARK(t, "log", test_log_benchmark);
+}
@@ -0,0 +1,9 @@
+#ifndef TEST_LOG_H
+#define TEST_LOG_H
+
+#include "test_framework.h"
+
+// Declaration of log module test function
+void test_log_module(test_context* t);
+
+#endif /* TEST_LOG_H */
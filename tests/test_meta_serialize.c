@@ -0,0 +1,323 @@
+// Tests for meta serialize module
+#include "test_meta_serialize.h"
+#include "meta_serialize.h"
+#include "mem.h"
+#include "print.h"
+
+typedef struct {
+    i32 x;
+    i32 y;
+    u64 id;
+} packed_t;
+
+static const field_descriptor packed_fields[] = {
+    {STR("x"), offsetof(packed_t, x), &i32_meta},
+    {STR("y"), offsetof(packed_t, y), &i32_meta},
+    {STR("id"), offsetof(packed_t, id), &u64_meta},
+};
+
+static const meta packed_meta = {
+    .type_name = STR("packed_t"),
+    .type_size = sizeof(packed_t),
+    .pt = PT_NONE,
+    .fields = {RANGE(packed_fields)},
+};
+
+typedef struct {
+    u8 tag;
+    u32 value;
+    u16 count;
+} padded_t;
+
+static const field_descriptor padded_fields[] = {
+    {STR("tag"), offsetof(padded_t, tag), &u8_meta},
+    {STR("value"), offsetof(padded_t, value), &u32_meta},
+    {STR("count"), offsetof(padded_t, count), &u16_meta},
+};
+
+static const meta padded_meta = {
+    .type_name = STR("padded_t"),
+    .type_size = sizeof(padded_t),
+    .pt = PT_NONE,
+    .fields = {RANGE(padded_fields)},
+};
+
+typedef struct {
+    i32* begin;
+    i32* end;
+} i32_array_t;
+
+static const meta i32_array_meta = {
+    .type_size = sizeof(i32_array_t),
+    .pt = PT_ARRAY,
+    .array_element_meta = &i32_meta
+};
+
+typedef struct {
+    u8 tag;
+    i32_array_t values;
+    f64 weight;
+} inner_t;
+
+static const field_descriptor inner_fields[] = {
+    {STR("tag"), offsetof(inner_t, tag), &u8_meta},
+    {STR("values"), offsetof(inner_t, values), &i32_array_meta},
+    {STR("weight"), offsetof(inner_t, weight), &f64_meta},
+};
+
+static const meta inner_meta = {
+    .type_name = STR("inner_t"),
+    .type_size = sizeof(inner_t),
+    .pt = PT_NONE,
+    .fields = {RANGE(inner_fields)},
+};
+
+typedef struct {
+    inner_t* begin;
+    inner_t* end;
+} inner_array_t;
+
+static const meta inner_array_meta = {
+    .type_size = sizeof(inner_array_t),
+    .pt = PT_ARRAY,
+    .array_element_meta = &inner_meta
+};
+
+typedef struct {
+    u16 id;
+    inner_array_t inners;
+} outer_t;
+
+static const field_descriptor outer_fields[] = {
+    {STR("id"), offsetof(outer_t, id), &u16_meta},
+    {STR("inners"), offsetof(outer_t, inners), &inner_array_meta},
+};
+
+static const meta outer_meta = {
+    .type_name = STR("outer_t"),
+    .type_size = sizeof(outer_t),
+    .pt = PT_NONE,
+    .fields = {RANGE(outer_fields)},
+};
+
+static void test_meta_serialize_packed(test_context* t) {
+    uptr size = 1024;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    packed_t value = {-3, 7, 0x0102030405060708ull};
+    u8* begin = meta_serialize(&alloc, &packed_meta, &value);
+    u8* end = alloc.cursor;
+
+    // Without padding, the bytes are the memory of the struct
+    TEST_ASSERT_EQUAL(t, bytesize(begin, end), sizeof(packed_t));
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, begin, end, &value, byteoffset(&value, sizeof(value))));
+
+    packed_t copy = {0};
+    TEST_ASSERT_TRUE(t, meta_deserialize(&alloc, &packed_meta, begin, end, &copy) == end);
+    TEST_ASSERT_EQUAL(t, copy.x, -3);
+    TEST_ASSERT_EQUAL(t, copy.y, 7);
+    TEST_ASSERT_EQUAL(t, copy.id, 0x0102030405060708ull);
+
+    sa_free(&alloc, begin);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+static void test_meta_serialize_padding(test_context* t) {
+    uptr size = 1024;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    padded_t value;
+    sa_set(&alloc, &value, byteoffset(&value, sizeof(value)), 0xAA);
+    value.tag = 0x11;
+    value.value = 0x22334455;
+    value.count = 0x6677;
+    u8* begin = meta_serialize(&alloc, &padded_meta, &value);
+    u8* end = alloc.cursor;
+
+    // Padding is skipped and the fields are little-endian
+    const u8 expected[] = {0x11, 0x55, 0x44, 0x33, 0x22, 0x77, 0x66};
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, begin, end, expected, expected + sizeof(expected)));
+
+    padded_t copy = {0};
+    TEST_ASSERT_TRUE(t, meta_deserialize(&alloc, &padded_meta, begin, end, &copy) == end);
+    TEST_ASSERT_EQUAL(t, copy.tag, 0x11);
+    TEST_ASSERT_EQUAL(t, copy.value, 0x22334455u);
+    TEST_ASSERT_EQUAL(t, copy.count, 0x6677);
+
+    sa_free(&alloc, begin);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+static void test_meta_serialize_nested_arrays(test_context* t) {
+    uptr size = 4096;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    i32 first_values[] = {1, -2, 3};
+    inner_t inners[] = {
+        {1, {first_values, first_values + 3}, 0.5},
+        {2, {0, 0}, -1.25},
+        {3, {first_values + 1, first_values + 2}, 1e300},
+    };
+    outer_t value = {42, {inners, inners + 3}};
+
+    u8* begin = meta_serialize(&alloc, &outer_meta, &value);
+    u8* end = alloc.cursor;
+    // id, count, then per inner: tag, count, values, weight
+    TEST_ASSERT_EQUAL(t, bytesize(begin, end), 2 + 8 + (1 + 8 + 12 + 8) + (1 + 8 + 8) + (1 + 8 + 4 + 8));
+
+    outer_t copy = {0};
+    TEST_ASSERT_TRUE(t, meta_deserialize(&alloc, &outer_meta, begin, end, &copy) == end);
+    TEST_ASSERT_EQUAL(t, copy.id, 42);
+    TEST_ASSERT_EQUAL(t, copy.inners.end - copy.inners.begin, 3);
+    // Element storage is allocated from alloc, after the bytes
+    TEST_ASSERT_TRUE(t, (u8*)copy.inners.begin >= end);
+    TEST_ASSERT_EQUAL(t, (uptr)copy.inners.begin % sizeof(u64), 0);
+    for (uptr i = 0; i < 3; ++i) {
+        const inner_t* left = &inners[i];
+        const inner_t* right = &copy.inners.begin[i];
+        TEST_ASSERT_EQUAL(t, left->tag, right->tag);
+        TEST_ASSERT_TRUE(t, left->weight == right->weight);
+        TEST_ASSERT_EQUAL(t, left->values.end - left->values.begin, right->values.end - right->values.begin);
+        TEST_ASSERT_TRUE(t, sa_equals(&alloc, left->values.begin, left->values.end, right->values.begin, right->values.end));
+    }
+
+    // Serializing the copy gives the same bytes
+    u8* again = meta_serialize(&alloc, &outer_meta, &copy);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, begin, end, again, alloc.cursor));
+
+    sa_free(&alloc, begin);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+static void test_meta_serialize_truncated(test_context* t) {
+    uptr size = 4096;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    i32 values[] = {5, 6};
+    inner_t inners[] = {{9, {values, values + 2}, 2.0}};
+    outer_t value = {7, {inners, inners + 1}};
+    u8* begin = meta_serialize(&alloc, &outer_meta, &value);
+    u8* end = alloc.cursor;
+
+    // Every shorter input fails and leaves nothing allocated
+    u8 all_failed = 1;
+    for (u8* truncated = begin; truncated < end; ++truncated) {
+        outer_t copy = {0};
+        all_failed &= meta_deserialize(&alloc, &outer_meta, begin, truncated, &copy) == 0;
+        all_failed &= alloc.cursor == (void*)end;
+    }
+    TEST_ASSERT_TRUE(t, all_failed);
+
+    // A count larger than the input is rejected before allocating
+    u8 corrupted[2 + 8];
+    sa_set(&alloc, corrupted, corrupted + sizeof(corrupted), 0xFF);
+    outer_t copy = {0};
+    TEST_ASSERT_NULL(t, meta_deserialize(&alloc, &outer_meta, corrupted, corrupted + sizeof(corrupted), &copy));
+    TEST_ASSERT_TRUE(t, alloc.cursor == (void*)end);
+
+    sa_free(&alloc, begin);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+typedef struct {
+    string name;
+    u32 score;
+} named_t;
+
+static const field_descriptor named_fields[] = {
+    {STR("name"), offsetof(named_t, name), &string_meta},
+    {STR("score"), offsetof(named_t, score), &u32_meta},
+};
+
+static const meta named_meta = {
+    .type_name = STR("named_t"),
+    .type_size = sizeof(named_t),
+    .pt = PT_NONE,
+    .fields = {RANGE(named_fields)},
+};
+
+static void test_meta_serialize_string(test_context* t) {
+    uptr size = 1024;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    named_t value = {STR("snake"), 12};
+    u8* begin = meta_serialize(&alloc, &named_meta, &value);
+    u8* end = alloc.cursor;
+    TEST_ASSERT_EQUAL(t, bytesize(begin, end), 8 + 5 + 4);
+
+    // The text is copied into alloc
+    named_t copy = {0};
+    TEST_ASSERT_TRUE(t, meta_deserialize(&alloc, &named_meta, begin, end, &copy) == end);
+    TEST_ASSERT_TRUE(t, (u8*)copy.name.begin >= end);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, copy.name.begin, copy.name.end, value.name.begin, value.name.end));
+    TEST_ASSERT_EQUAL(t, copy.score, 12);
+
+    sa_free(&alloc, begin);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+typedef struct {
+    string* begin;
+    string* end;
+} string_array_t;
+
+static const meta string_array_meta = {
+    .type_size = sizeof(string_array_t),
+    .pt = PT_ARRAY,
+    .array_element_meta = &string_meta
+};
+
+// Strings take 16 bytes in memory and at least 8 serialized, a count is bounded by both
+static void test_meta_serialize_string_array_count(test_context* t) {
+    uptr size = 512;
+    void* memory = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, memory, byteoffset(memory, size));
+
+    u8 input[8 + 8 * 40];
+    sa_set(&alloc, input, input + sizeof(input), 0);
+    string_array_t copy = {0};
+
+    // More elements than 8 bytes of input each
+    input[0] = 41;
+    TEST_ASSERT_NULL(t, meta_deserialize(&alloc, &string_array_meta, input, input + sizeof(input), &copy));
+    TEST_ASSERT_TRUE(t, alloc.cursor == memory);
+
+    // Empty strings the input holds, but more than the arena does
+    input[0] = 40;
+    TEST_ASSERT_NULL(t, meta_deserialize(&alloc, &string_array_meta, input, input + sizeof(input), &copy));
+    TEST_ASSERT_TRUE(t, alloc.cursor == memory);
+
+    // Fitting both
+    input[0] = 20;
+    TEST_ASSERT_TRUE(t, meta_deserialize(&alloc, &string_array_meta, input, input + 8 + 8 * 20, &copy) == input + 8 + 8 * 20);
+    TEST_ASSERT_EQUAL(t, copy.end - copy.begin, 20);
+
+    sa_free(&alloc, memory);
+    sa_deinit(&alloc);
+    mem_unmap(memory, size);
+}
+
+void test_meta_serialize_module(test_context* t) {
+    REGISTER_TEST(t, "meta_serialize_packed", test_meta_serialize_packed);
+    REGISTER_TEST(t, "meta_serialize_padding", test_meta_serialize_padding);
+    REGISTER_TEST(t, "meta_serialize_nested_arrays", test_meta_serialize_nested_arrays);
+    REGISTER_TEST(t, "meta_serialize_truncated", test_meta_serialize_truncated);
+    REGISTER_TEST(t, "meta_serialize_string", test_meta_serialize_string);
+    REGISTER_TEST(t, "meta_serialize_string_array_count", test_meta_serialize_string_array_count);
+}
@@ -0,0 +1,9 @@
+#ifndef TEST_META_SERIALIZE_H
+#define TEST_META_SERIALIZE_H
+
+#include "test_framework.h"
+
+// Declaration of meta serialize module test function
+void test_meta_serialize_module(test_context* t);
+
+#endif /* TEST_META_SERIALIZE_H */
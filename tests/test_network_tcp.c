@@ -5,8 +5,19 @@
 #include "primitive.h"
 #include "network/tcp/tcp_connection.h"
 #include "network/tcp/tcp_read_write.h"
+#include "network/tcp/tcp_reactor.h"
+#include "network/tcp/tcp_server.h"
+#include "network/tcp/tcp_stream.h"
 #include "test_network_tcp.h"
 #include "print.h"
+#include "convert.h"
+#include "file.h"
+#include "test_temp_dir.h"
+#include "thread.h"
+#include "system_time.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
 
 /* Single-threaded non-blocking client/server test:
    - Create a listening server bound to 127.0.0.1:0 (ephemeral port)
@@ -145,6 +156,529 @@ static void test_tcp_nonblocking_single_threaded(test_context* t) {
     mem_unmap(pointer, size);
 }
 
+/* Blocking transfer of a file range from client -> server with tcp_send_file. */
+static void test_tcp_send_file(test_context* t) {
+    uptr size = 64 * 1024;
+    void* pointer = mem_map(size);
+    TEST_ASSERT_TRUE(t, pointer != 0);
+    stack_alloc alloc;
+    sa_init(&alloc, pointer, byteoffset(pointer, size));
+
+    setup_test_temp_dir();
+    const string path = STR("test_temp/send_file.txt");
+    const string content = STR("header|file content sent without copy");
+    file_t file = file_open(&alloc, path.begin, path.end, FILE_MODE_WRITE);
+    file_write(file, content.begin, content.end);
+    file_close(file);
+    file = file_open(&alloc, path.begin, path.end, FILE_MODE_READ);
+    TEST_ASSERT_NOT_EQUAL(t, file, file_invalid());
+
+    string _host = STR("127.0.0.1");
+    u8_slice host = {(void*)_host.begin, (void*)_host.end};
+    string _port = STR("8002");
+    u8_slice port = {(void*)_port.begin, (void*)_port.end};
+    tcp* server = tcp_init_server(host, port, &alloc);
+    TEST_ASSERT_TRUE(t, server != 0);
+    tcp* client = tcp_init_client(host, port, &alloc);
+    TEST_ASSERT_TRUE(t, client != 0);
+    TEST_ASSERT_TRUE(t, tcp_connect(client));
+    tcp* server_peer = tcp_accept(server, &alloc);
+    TEST_ASSERT_TRUE(t, server_peer != 0);
+
+    /* Send everything after the header */
+    const uptr offset = 7;
+    const uptr expected = bytesize(content.begin, content.end) - offset;
+    uptr sent = 0;
+    while (sent < expected) {
+        tcp_w_result wres = tcp_send_file(client, file, offset + sent, expected - sent);
+        TEST_ASSERT_EQUAL(t, wres.status, TCP_RW_OK);
+        if (wres.status != TCP_RW_OK) break;
+        sent += wres.bytes;
+    }
+
+    /* Past the end of the file */
+    TEST_ASSERT_EQUAL(t, tcp_send_file(client, file, bytesize(content.begin, content.end), 16).status, TCP_RW_EOF);
+
+    u8* received = alloc.cursor;
+    while (bytesize(received, alloc.cursor) < sent) {
+        tcp_r_result rres = tcp_read_once(server_peer, &alloc, sent - bytesize(received, alloc.cursor));
+        if (rres.status != TCP_RW_OK) break;
+    }
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, received, alloc.cursor, byteoffset(content.begin, offset), content.end));
+    sa_free(&alloc, received);
+
+    tcp_close(server_peer);
+    sa_free(&alloc, server_peer);
+    tcp_close(client);
+    sa_free(&alloc, client);
+    tcp_close(server);
+    sa_free(&alloc, server);
+
+    file_close(file);
+    cleanup_test_temp_dir();
+
+    sa_deinit(&alloc);
+    mem_unmap(pointer, size);
+}
+
+/* Echo server and its clients all served by one reactor thread */
+#define REACTOR_CLIENTS 256
+
+typedef struct {
+    tcp* server;
+    stack_alloc* alloc;
+    u32 listener_id;
+    u32 guard_timer;
+    u32 accepted;
+    u32 peers_closed;
+    u32 echoed;
+    u8 timed_out;
+} reactor_echo;
+
+typedef struct {
+    reactor_echo* echo;
+    tcp* connection;
+    uptr received;
+    u8 matches;
+} reactor_client;
+
+static const string reactor_message = STR("ping from a reactor client");
+
+static void reactor_echo_done_check(tcp_reactor* reactor, reactor_echo* echo) {
+    if (echo->peers_closed == REACTOR_CLIENTS && echo->echoed == REACTOR_CLIENTS) {
+        tcp_reactor_remove(reactor, echo->listener_id);
+        tcp_reactor_cancel_timer(reactor, echo->guard_timer);
+    }
+}
+
+static void reactor_echo_peer(tcp_reactor* reactor, const tcp_reactor_event* event) {
+    reactor_echo* echo = event->context;
+    /* Edge triggered, read everything available */
+    while (1) {
+        u8 buffer[64];
+        stack_alloc local;
+        sa_init(&local, buffer, buffer + sizeof(buffer));
+        tcp_r_result rres = tcp_read_once(event->connection, &local, sizeof(buffer));
+        if (rres.status == TCP_RW_OK) {
+            tcp_write_once(event->connection, (u8_slice){buffer, local.cursor});
+            sa_free(&local, buffer);
+            sa_deinit(&local);
+            continue;
+        }
+        sa_deinit(&local);
+        if (rres.status == TCP_RW_EOF) {
+            tcp_reactor_remove(reactor, event->id);
+            tcp_close(event->connection);
+            echo->peers_closed += 1;
+            reactor_echo_done_check(reactor, echo);
+        }
+        return;
+    }
+}
+
+static void reactor_echo_accept(tcp_reactor* reactor, const tcp_reactor_event* event) {
+    reactor_echo* echo = event->context;
+    tcp* peer;
+    while ((peer = tcp_accept(echo->server, echo->alloc))) {
+        tcp_set_nonblocking(peer, 1);
+        tcp_reactor_add(reactor, peer, TCP_REACTOR_READ, reactor_echo_peer, echo);
+        echo->accepted += 1;
+    }
+}
+
+static void reactor_echo_client(tcp_reactor* reactor, const tcp_reactor_event* event) {
+    reactor_client* client = event->context;
+    const uptr expected = bytesize(reactor_message.begin, reactor_message.end);
+    while (client->received < expected) {
+        u8 buffer[64];
+        stack_alloc local;
+        sa_init(&local, buffer, buffer + sizeof(buffer));
+        tcp_r_result rres = tcp_read_once(event->connection, &local, expected - client->received);
+        const uptr got = bytesize(buffer, local.cursor);
+        client->matches &= got == 0 || sa_equals(&local, buffer, local.cursor, byteoffset(reactor_message.begin, client->received), byteoffset(reactor_message.begin, client->received + got));
+        client->received += got;
+        sa_free(&local, buffer);
+        sa_deinit(&local);
+        if (rres.status != TCP_RW_OK) {
+            return;
+        }
+    }
+    client->echo->echoed += client->matches;
+    tcp_reactor_remove(reactor, event->id);
+    tcp_close(event->connection);
+}
+
+static void reactor_echo_guard(tcp_reactor* reactor, void* context) {
+    reactor_echo* echo = context;
+    echo->timed_out = 1;
+    tcp_reactor_stop(reactor);
+}
+
+static void test_tcp_reactor_echo(test_context* t) {
+    uptr size = 1024 * 1024;
+    void* pointer = mem_map(size);
+    TEST_ASSERT_TRUE(t, pointer != 0);
+    stack_alloc alloc;
+    sa_init(&alloc, pointer, byteoffset(pointer, size));
+    void* begin = alloc.cursor;
+
+    string _host = STR("127.0.0.1");
+    u8_slice host = {(void*)_host.begin, (void*)_host.end};
+    string _port = STR("8004");
+    u8_slice port = {(void*)_port.begin, (void*)_port.end};
+    tcp* server = tcp_init_server(host, port, &alloc);
+    TEST_ASSERT_TRUE(t, server != 0);
+    tcp_set_nonblocking(server, 1);
+
+    tcp_reactor* reactor = tcp_reactor_open(&alloc, 2 * REACTOR_CLIENTS + 1, 4);
+    TEST_ASSERT_TRUE(t, reactor != 0);
+    reactor_echo echo = {0};
+    echo.server = server;
+    echo.alloc = &alloc;
+    echo.listener_id = tcp_reactor_add(reactor, server, TCP_REACTOR_READ, reactor_echo_accept, &echo);
+    TEST_ASSERT_NOT_EQUAL(t, echo.listener_id, 0);
+    echo.guard_timer = tcp_reactor_timer(reactor, 10000, reactor_echo_guard, &echo);
+
+    /* Connections wait in the backlog until the reactor accepts them */
+    reactor_client* clients = sa_alloc(&alloc, sizeof(*clients) * REACTOR_CLIENTS);
+    u32 connected = 0;
+    for (u32 i = 0; i < REACTOR_CLIENTS; ++i) {
+        tcp* client = tcp_init_client(host, port, &alloc);
+        connected += tcp_connect(client);
+        u8_slice message = {(u8*)reactor_message.begin, (u8*)reactor_message.end};
+        tcp_write_once(client, message);
+        tcp_set_nonblocking(client, 1);
+        clients[i] = (reactor_client){&echo, client, 0, 1};
+        tcp_reactor_add(reactor, client, TCP_REACTOR_READ, reactor_echo_client, &clients[i]);
+    }
+    TEST_ASSERT_EQUAL(t, connected, REACTOR_CLIENTS);
+
+    tcp_reactor_run(reactor);
+    TEST_ASSERT_FALSE(t, echo.timed_out);
+    TEST_ASSERT_EQUAL(t, echo.accepted, REACTOR_CLIENTS);
+    TEST_ASSERT_EQUAL(t, echo.echoed, REACTOR_CLIENTS);
+    TEST_ASSERT_EQUAL(t, echo.peers_closed, REACTOR_CLIENTS);
+
+    if (echo.timed_out) {
+        for (u32 i = 0; i < REACTOR_CLIENTS; ++i) {
+            tcp_close(clients[i].connection);
+        }
+    }
+    tcp_reactor_close(reactor);
+    tcp_close(server);
+    sa_free(&alloc, begin);
+    sa_deinit(&alloc);
+    mem_unmap(pointer, size);
+}
+
+typedef struct {
+    u32 order[4];
+    u32 count;
+} reactor_timer_log;
+
+static void reactor_timer_10(tcp_reactor* reactor, void* context) {
+    unused(reactor);
+    reactor_timer_log* log = context;
+    log->order[log->count++] = 10;
+}
+
+static void reactor_timer_20(tcp_reactor* reactor, void* context) {
+    unused(reactor);
+    reactor_timer_log* log = context;
+    log->order[log->count++] = 20;
+}
+
+static void reactor_timer_30(tcp_reactor* reactor, void* context) {
+    unused(reactor);
+    reactor_timer_log* log = context;
+    log->order[log->count++] = 30;
+}
+
+/* Timers run in deadline order, cancelled ones never */
+static void test_tcp_reactor_timers(test_context* t) {
+    uptr size = 4096;
+    void* pointer = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, pointer, byteoffset(pointer, size));
+
+    tcp_reactor* reactor = tcp_reactor_open(&alloc, 1, 4);
+    reactor_timer_log log = {{0}, 0};
+    tcp_reactor_timer(reactor, 30, reactor_timer_30, &log);
+    tcp_reactor_timer(reactor, 10, reactor_timer_10, &log);
+    const u32 cancelled = tcp_reactor_timer(reactor, 15, reactor_timer_30, &log);
+    tcp_reactor_timer(reactor, 20, reactor_timer_20, &log);
+    TEST_ASSERT_EQUAL(t, tcp_reactor_timer(reactor, 40, reactor_timer_30, &log), 0);
+    tcp_reactor_cancel_timer(reactor, cancelled);
+
+    /* Nothing to wait for before the first deadline */
+    TEST_ASSERT_EQUAL(t, tcp_reactor_run_once(reactor, 0), 0);
+    tcp_reactor_run(reactor);
+    TEST_ASSERT_EQUAL(t, log.count, 3);
+    TEST_ASSERT_TRUE(t, log.order[0] == 10 && log.order[1] == 20 && log.order[2] == 30);
+
+    tcp_reactor_close(reactor);
+    sa_free(&alloc, reactor);
+    sa_deinit(&alloc);
+    mem_unmap(pointer, size);
+}
+
+/* Workers of a server echo on their own thread */
+#define SERVER_WORKERS 4
+#define SERVER_CLIENTS 64
+
+typedef struct {
+    u32 accepted[SERVER_WORKERS];
+    u32 released;
+} server_echo;
+
+static void server_echo_peer(tcp_reactor* reactor, const tcp_reactor_event* event) {
+    tcp_server_worker* worker = event->context;
+    server_echo* echo = worker->context;
+    while (1) {
+        u8 buffer[64];
+        stack_alloc local;
+        sa_init(&local, buffer, buffer + sizeof(buffer));
+        tcp_r_result rres = tcp_read_once(event->connection, &local, sizeof(buffer));
+        if (rres.status == TCP_RW_OK) {
+            tcp_write_once(event->connection, (u8_slice){buffer, local.cursor});
+            sa_free(&local, buffer);
+            sa_deinit(&local);
+            continue;
+        }
+        sa_deinit(&local);
+        if (rres.status == TCP_RW_EOF) {
+            tcp_reactor_remove(reactor, event->id);
+            tcp_server_release(worker, event->connection);
+            __atomic_add_fetch(&echo->released, 1, __ATOMIC_RELAXED);
+        }
+        return;
+    }
+}
+
+static void server_echo_accept(tcp_server_worker* worker, tcp* connection) {
+    server_echo* echo = worker->context;
+    __atomic_add_fetch(&echo->accepted[worker->index], 1, __ATOMIC_RELAXED);
+    tcp_reactor_add(worker->reactor, connection, TCP_REACTOR_READ, server_echo_peer, worker);
+}
+
+static void test_tcp_server_reuseport(test_context* t) {
+    uptr size = 64 * 1024;
+    void* pointer = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, pointer, byteoffset(pointer, size));
+
+    string _host = STR("127.0.0.1");
+    u8_slice host = {(void*)_host.begin, (void*)_host.end};
+    string _port = STR("8006");
+    u8_slice port = {(void*)_port.begin, (void*)_port.end};
+    server_echo echo = {{0}, 0};
+    tcp_server_config config = {SERVER_WORKERS, 64, 64 * 1024, server_echo_accept, &echo};
+    tcp_server* server = tcp_server_start(host, port, config, &alloc);
+    TEST_ASSERT_TRUE(t, server != 0);
+    TEST_ASSERT_EQUAL(t, tcp_server_worker_count(server), SERVER_WORKERS);
+
+    u32 echoed = 0;
+    for (u32 i = 0; i < SERVER_CLIENTS; ++i) {
+        tcp* client = tcp_init_client(host, port, &alloc);
+        if (tcp_connect(client)) {
+            const string message = STR("ping from a client");
+            tcp_write_once(client, (u8_slice){(u8*)message.begin, (u8*)message.end});
+            u8* received = alloc.cursor;
+            while (bytesize(received, alloc.cursor) < bytesize(message.begin, message.end)) {
+                tcp_r_result rres = tcp_read_once(client, &alloc, bytesize(message.begin, message.end) - bytesize(received, alloc.cursor));
+                if (rres.status != TCP_RW_OK) break;
+            }
+            echoed += sa_equals(&alloc, received, alloc.cursor, message.begin, message.end);
+            sa_free(&alloc, received);
+        }
+        tcp_close(client);
+        sa_free(&alloc, client);
+    }
+    TEST_ASSERT_EQUAL(t, echoed, SERVER_CLIENTS);
+
+    /* Wait for the workers to see the clients close */
+    for (u32 i = 0; i < 1000 && __atomic_load_n(&echo.released, __ATOMIC_RELAXED) < SERVER_CLIENTS; ++i) {
+        thread_current_sleep_until_us(sys_time_us() + 1000);
+    }
+    tcp_server_stop(server);
+    sa_free(&alloc, server);
+
+    u32 accepted = 0;
+    u32 busy_workers = 0;
+    for (u32 i = 0; i < SERVER_WORKERS; ++i) {
+        accepted += echo.accepted[i];
+        busy_workers += echo.accepted[i] > 0;
+    }
+    TEST_ASSERT_EQUAL(t, accepted, SERVER_CLIENTS);
+    TEST_ASSERT_EQUAL(t, echo.released, SERVER_CLIENTS);
+    /* The kernel hashes the connections over the listeners */
+    TEST_ASSERT_TRUE(t, busy_workers > 1);
+
+    sa_deinit(&alloc);
+    mem_unmap(pointer, size);
+}
+
+/* A connection arriving while the process has no descriptor left is refused, and the worker
+   serves the connections after it */
+static void test_tcp_server_descriptors_exhausted(test_context* t) {
+    uptr size = 64 * 1024;
+    void* pointer = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, pointer, byteoffset(pointer, size));
+
+    string _host = STR("127.0.0.1");
+    u8_slice host = {(void*)_host.begin, (void*)_host.end};
+    string _port = STR("8007");
+    u8_slice port = {(void*)_port.begin, (void*)_port.end};
+    server_echo echo = {{0}, 0};
+    tcp_server_config config = {1, 64, 64 * 1024, server_echo_accept, &echo};
+    tcp_server* server = tcp_server_start(host, port, config, &alloc);
+    TEST_ASSERT_TRUE(t, server != 0);
+
+    /* Use up the descriptors, the client socket takes the last one */
+    tcp* refused = tcp_init_client(host, port, &alloc);
+    struct rlimit limit;
+    getrlimit(RLIMIT_NOFILE, &limit);
+    const struct rlimit lowered = {256, limit.rlim_max};
+    setrlimit(RLIMIT_NOFILE, &lowered);
+    int fillers[256];
+    u32 filler_count = 0;
+    while (filler_count < 256 && (fillers[filler_count] = dup(0)) >= 0) {
+        filler_count += 1;
+    }
+    TEST_ASSERT_TRUE(t, filler_count > 0 && filler_count < 256);
+    TEST_ASSERT_TRUE(t, tcp_connect(refused));
+
+    u8 closed = 0;
+    for (u32 i = 0; i < 1000 && !closed; ++i) {
+        if (tcp_is_readable(refused)) {
+            tcp_r_result rres = tcp_read_once(refused, &alloc, 64);
+            closed = rres.status == TCP_RW_EOF;
+            break;
+        }
+        thread_current_sleep_until_us(sys_time_us() + 1000);
+    }
+    TEST_ASSERT_TRUE(t, closed);
+    tcp_close(refused);
+    sa_free(&alloc, refused);
+    for (u32 i = 0; i < filler_count; ++i) {
+        close(fillers[i]);
+    }
+    setrlimit(RLIMIT_NOFILE, &limit);
+
+    tcp* client = tcp_init_client(host, port, &alloc);
+    TEST_ASSERT_TRUE(t, tcp_connect(client));
+    const string message = STR("served");
+    tcp_write_once(client, (u8_slice){(u8*)message.begin, (u8*)message.end});
+    u8* received = alloc.cursor;
+    while (bytesize(received, alloc.cursor) < bytesize(message.begin, message.end)) {
+        tcp_r_result rres = tcp_read_once(client, &alloc, bytesize(message.begin, message.end) - bytesize(received, alloc.cursor));
+        if (rres.status != TCP_RW_OK) break;
+    }
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, received, alloc.cursor, message.begin, message.end));
+    sa_free(&alloc, received);
+    tcp_close(client);
+    sa_free(&alloc, client);
+
+    tcp_server_stop(server);
+    sa_free(&alloc, server);
+    TEST_ASSERT_EQUAL(t, echo.accepted[0], 1);
+    sa_deinit(&alloc);
+    mem_unmap(pointer, size);
+}
+
+/* Lines and length prefixed frames through buffered streams */
+static void test_tcp_stream_framing(test_context* t) {
+    uptr size = 1024 * 1024;
+    void* pointer = mem_map(size);
+    stack_alloc alloc;
+    sa_init(&alloc, pointer, byteoffset(pointer, size));
+
+    string _host = STR("127.0.0.1");
+    u8_slice host = {(void*)_host.begin, (void*)_host.end};
+    string _port = STR("8008");
+    u8_slice port = {(void*)_port.begin, (void*)_port.end};
+    tcp* server = tcp_init_server(host, port, &alloc);
+    tcp* client = tcp_init_client(host, port, &alloc);
+    TEST_ASSERT_TRUE(t, tcp_connect(client));
+    tcp* server_peer = tcp_accept(server, &alloc);
+    TEST_ASSERT_TRUE(t, server_peer != 0);
+
+    tcp_stream* writer = tcp_stream_open(client, 256, 4096, &alloc);
+    tcp_stream* reader = tcp_stream_open(server_peer, 128 * 1024, 256, &alloc);
+
+    /* Nothing sent yet */
+    tcp_set_nonblocking(server_peer, 1);
+    u8_slice line;
+    TEST_ASSERT_EQUAL(t, tcp_stream_read_until(reader, '\n', &line), TCP_RW_AGAIN);
+    tcp_set_nonblocking(server_peer, 0);
+
+    /* Small writes are buffered */
+    const u32 line_count = 1000;
+    u8 writes_ok = 1;
+    for (u32 i = 0; i < line_count; ++i) {
+        u8 text[32];
+        u8* end = (u8*)convert_u64_to_decimal(i, (char*)text);
+        *end++ = '\n';
+        writes_ok &= tcp_stream_write(writer, (u8_slice){text, end}).bytes == bytesize(text, end);
+    }
+    TEST_ASSERT_TRUE(t, writes_ok);
+    TEST_ASSERT_TRUE(t, tcp_stream_output_pending(writer) > 0);
+
+    /* A frame larger than the output buffer goes out with the pending lines */
+    const uptr frame_size = 100 * 1024;
+    u8* frame = sa_alloc(&alloc, frame_size);
+    for (uptr i = 0; i < frame_size; ++i) {
+        frame[i] = (u8)(i * 7);
+    }
+    u8 header[4] = {(u8)frame_size, (u8)(frame_size >> 8), (u8)(frame_size >> 16), 0};
+    TEST_ASSERT_EQUAL(t, tcp_stream_write(writer, (u8_slice){header, header + 4}).bytes, 4);
+    tcp_w_result wres = tcp_stream_write(writer, (u8_slice){frame, frame + frame_size});
+    TEST_ASSERT_EQUAL(t, wres.status, TCP_RW_OK);
+    TEST_ASSERT_EQUAL(t, wres.bytes, frame_size);
+    const string last = STR("no delimiter after this");
+    tcp_stream_write(writer, (u8_slice){(u8*)last.begin, (u8*)last.end});
+    TEST_ASSERT_EQUAL(t, tcp_stream_flush(writer), TCP_RW_OK);
+    TEST_ASSERT_EQUAL(t, tcp_stream_output_pending(writer), 0);
+    tcp_close(client);
+
+    u8 lines_ok = 1;
+    for (u32 i = 0; i < line_count; ++i) {
+        u8 text[32];
+        u8* end = (u8*)convert_u64_to_decimal(i, (char*)text);
+        *end++ = '\n';
+        lines_ok &= tcp_stream_read_until(reader, '\n', &line) == TCP_RW_OK
+            && sa_equals(&alloc, line.begin, line.end, text, end);
+    }
+    TEST_ASSERT_TRUE(t, lines_ok);
+
+    u8_slice slice;
+    TEST_ASSERT_EQUAL(t, tcp_stream_read_exact(reader, 4, &slice), TCP_RW_OK);
+    const uptr received_size = (uptr)slice.begin[0] | (uptr)slice.begin[1] << 8 | (uptr)slice.begin[2] << 16;
+    TEST_ASSERT_EQUAL(t, received_size, frame_size);
+    TEST_ASSERT_EQUAL(t, tcp_stream_read_exact(reader, received_size, &slice), TCP_RW_OK);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, slice.begin, slice.end, frame, frame + frame_size));
+
+    /* The tail without delimiter stays unread at the end of the stream */
+    TEST_ASSERT_EQUAL(t, tcp_stream_read_until(reader, '\n', &line), TCP_RW_EOF);
+    TEST_ASSERT_EQUAL(t, tcp_stream_read_exact(reader, bytesize(last.begin, last.end), &slice), TCP_RW_OK);
+    TEST_ASSERT_TRUE(t, sa_equals(&alloc, slice.begin, slice.end, last.begin, last.end));
+    TEST_ASSERT_EQUAL(t, tcp_stream_read_exact(reader, 1, &slice), TCP_RW_EOF);
+    TEST_ASSERT_EQUAL(t, tcp_stream_read_exact(reader, 128 * 1024 + 1, &slice), TCP_RW_ERR);
+
+    tcp_close(server_peer);
+    tcp_close(server);
+    sa_free(&alloc, server);
+    sa_deinit(&alloc);
+    mem_unmap(pointer, size);
+}
+
 void test_network_tcp_module(test_context* t) {
     REGISTER_TEST(t, "tcp_nonblocking_single_threaded", test_tcp_nonblocking_single_threaded);
+    REGISTER_TEST(t, "tcp_send_file", test_tcp_send_file);
+    REGISTER_TEST(t, "tcp_reactor_echo", test_tcp_reactor_echo);
+    REGISTER_TEST(t, "tcp_reactor_timers", test_tcp_reactor_timers);
+    REGISTER_TEST(t, "tcp_server_reuseport", test_tcp_server_reuseport);
+    REGISTER_TEST(t, "tcp_server_descriptors_exhausted", test_tcp_server_descriptors_exhausted);
+    REGISTER_TEST(t, "tcp_stream_framing", test_tcp_stream_framing);
 }
@@ -292,10 +292,56 @@ static void test_snake_multiple_input_between_update(test_context* t) {
     env_deinit(&env);
 }
 
+static u8 same_player_cells(snake* left, snake* right) {
+    position *left_begin, *left_end, *right_begin, *right_end;
+    snake_get_player_cells(left, &left_begin, &left_end);
+    snake_get_player_cells(right, &right_begin, &right_end);
+    if (left_end - left_begin != right_end - right_begin) {return 0;}
+    for (; left_begin < left_end; ++left_begin, ++right_begin) {
+        if (!snake_grid_equals(*left_begin, *right_begin)) {return 0;}
+    }
+    return 1;
+}
+
+static void test_snake_snapshot_restore(test_context* t) {
+    snake_test_env env = env_init();
+
+    // Eat the reward to have two cells
+    for (int i = 0; i < 4; ++i) {
+        env_update(&env, (snake_input){.up = 1});
+    }
+    for (int i = 0; i < 4; ++i) {
+        env_update(&env, (snake_input){.left = 1});
+    }
+
+    u8* snapshot = snake_snapshot(env.s, &env.alloc);
+    u8* snapshot_end = env.alloc.cursor;
+    TEST_ASSERT_NULL(t, snake_restore(&env.alloc, snapshot, snapshot_end - 1));
+    TEST_ASSERT_TRUE(t, env.alloc.cursor == (void*)snapshot_end);
+
+    snake* restored = snake_restore(&env.alloc, snapshot, snapshot_end);
+    TEST_ASSERT_NOT_NULL(t, restored);
+    TEST_ASSERT_TRUE(t, snake_end(restored) == env.alloc.cursor);
+    TEST_ASSERT_EQUAL(t, snake_get_grid_width(restored), snake_get_grid_width(env.s));
+    TEST_ASSERT_EQUAL(t, snake_get_grid_height(restored), snake_get_grid_height(env.s));
+    TEST_ASSERT_TRUE(t, snake_grid_equals(snake_get_reward(restored), snake_get_reward(env.s)));
+    TEST_ASSERT_TRUE(t, same_player_cells(restored, env.s));
+
+    // Both continue the same way, direction and timing included
+    env_update(&env, (snake_input){0});
+    snake_update(restored, (snake_input){0}, env.config.delta_time_between_movement, &env.alloc);
+    TEST_ASSERT_TRUE(t, same_player_cells(restored, env.s));
+
+    snake_deinit(restored, &env.alloc);
+    sa_free(&env.alloc, snapshot);
+    env_deinit(&env);
+}
+
 void test_snake_module(test_context* t) {
     REGISTER_TEST(t, "snake_render", test_render);
     REGISTER_TEST(t, "snake_move_towards_reward", test_snake_move_towards_reward);
     REGISTER_TEST(t, "snake_boundary_left_top", test_snake_boundary_left_top);
     REGISTER_TEST(t, "snake_increase_size_on_reward", test_snake_increase_size_on_reward);
     REGISTER_TEST(t, "snake_multiple_input_between_update", test_snake_multiple_input_between_update);
+    REGISTER_TEST(t, "snake_snapshot_restore", test_snake_snapshot_restore);
 }
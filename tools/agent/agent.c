@@ -48,27 +48,27 @@ i32 main(i32 argc, char** argv) {
     }
 
     // Read the file
-    file_t file = file_open(alloc, args.file_path.begin, args.file_path.end, FILE_MODE_READ_WRITE);
-    u8_slice file_content;
-    file_read_all(file, (void**)&file_content.begin, alloc);
-    file_content.end = alloc->cursor;
+    file_t file = file_open(alloc, args.file_path.begin, args.file_path.end, FILE_MODE_READ);
+    u8_slice file_content = file_map_readonly(file);
+    file_close(file);
 
     u8_slice user_content;
     user_content.begin = user_content_read(alloc, file_content);
     user_content.end = alloc->cursor;
 
-    sa_move_tail(alloc, user_content.begin, file_content.begin);
-    const uptr user_content_size = bytesize(user_content.begin, user_content.end);
-    user_content.begin = file_content.begin;
-    user_content.end = byteoffset(user_content.begin, user_content_size);
-    file_content.begin = 0;file_content.end = 0;
-
     u8_slice agent_result;
     agent_result.begin = agent_request(user_content, args.api_key, args.model, args.prompt_id, alloc);
     agent_result.end = alloc->cursor;
 
-    agent_result_write(file, alloc, agent_result);
-    file_close(file);
+    // Rewrite the file with the result appended, an interrupted write leaves the original intact
+    file_atomic* atomic = file_atomic_open(alloc, args.file_path.begin, args.file_path.end);
+    if (atomic) {
+        file_write(file_atomic_file(atomic), file_content.begin, file_content.end);
+        agent_result_write(file_atomic_file(atomic), agent_result);
+        file_atomic_commit(alloc, atomic, 0);
+    }
+    file_unmap(file_content);
+    file_content.begin = 0;file_content.end = 0;
 
     sa_free(alloc, agent_result.begin);
     sa_free(alloc, user_content.begin);
@@ -2,113 +2,109 @@
 
 #include "assert.h"
 #include "network/https/https_request.h"
+#include "json.h"
 
 #include "print.h"
 
-static u8* format_user_content(u8_slice user_content, stack_alloc* alloc) {
-    void* begin = alloc->cursor;
-    u8* p = user_content.begin;
-    u8* e = user_content.end;
-    for (; p < e; ++p) {
-        u8 c = *p;
-        if (c == '\n') {
-            ((u8*)alloc->cursor)[0] = '\\';
-            ((u8*)alloc->cursor)[1] = 'n';
-            alloc->cursor = byteoffset(alloc->cursor, 2);
-        } else if (c == '"') {
-            ((u8*)alloc->cursor)[0] = '\\';
-            ((u8*)alloc->cursor)[1] = '"';
-            alloc->cursor = byteoffset(alloc->cursor, 2);
-        } else if (c == '\\' && *(p+1) != 'n') {
-            ((u8*)alloc->cursor)[0] = '\\';
-            ((u8*)alloc->cursor)[1] = '\\';
-            alloc->cursor = byteoffset(alloc->cursor, 2);
-        } else {
-            ((u8*)alloc->cursor)[0] = c;
-            alloc->cursor = byteoffset(alloc->cursor, 1);
-        }
+// Body of the request, encoded from its meta description
+typedef struct {
+    string id;
+} request_prompt;
+
+static const field_descriptor request_prompt_fields[] = {
+    {STR("id"), offsetof(request_prompt, id), &string_meta},
+};
+
+static const meta request_prompt_meta = {
+    .type_name = STR("request_prompt"),
+    .type_size = sizeof(request_prompt),
+    .pt = PT_NONE,
+    .fields = {RANGE(request_prompt_fields)},
+};
+
+typedef struct {
+    string model;
+    request_prompt prompt;
+    string input;
+} request_body;
+
+static const field_descriptor request_body_fields[] = {
+    {STR("model"), offsetof(request_body, model), &string_meta},
+    {STR("prompt"), offsetof(request_body, prompt), &request_prompt_meta},
+    {STR("input"), offsetof(request_body, input), &string_meta},
+};
+
+static const meta request_body_meta = {
+    .type_name = STR("request_body"),
+    .type_size = sizeof(request_body),
+    .pt = PT_NONE,
+    .fields = {RANGE(request_body_fields)},
+};
+
+// Body of an HTTP response, a chunked transfer encoding is decoded in place
+static u8_slice response_body(stack_alloc* alloc, u8_slice response) {
+    const string separator = STR("\r\n\r\n");
+    u8* header_end = sa_find(alloc, response.begin, response.end, separator.begin, separator.end);
+    if (!header_end) {
+        return (u8_slice){response.end, response.end};
     }
-
-    return begin;
-}
-
-static u8_slice extract_answer(u8_slice api_output) {
-    u8_slice answer;
-    answer.begin = api_output.begin;
-    answer.end = api_output.begin;
-
-    const u8* begin = api_output.begin;
-    const u8* end = api_output.end;
-
-    // Patterns to search
-    const u8 pat_output[] = "\"output\"";
-    const uptr pat_output_len = sizeof(pat_output) - 1;
-    const u8 pat_text[] = "\"text\"";
-    const uptr pat_text_len = sizeof(pat_text) - 1;
-
-    // Find "output"
-    const u8* cur = begin;
-    const u8* pos_output = end;
-    while (cur < end) {
-        if ((uptr)(end - cur) < pat_output_len) break;
-        uptr i = 0;
-        while (i < pat_output_len && cur[i] == pat_output[i]) ++i;
-        if (i == pat_output_len) { pos_output = cur; break; }
-        ++cur;
+    u8_slice body = {header_end + bytesize(separator.begin, separator.end), response.end};
+    const string chunked = STR("chunked");
+    if (!sa_contains(alloc, response.begin, header_end, chunked.begin, chunked.end)) {
+        return body;
     }
-    if (pos_output == end) {
-        return answer;
+
+    // Chunks are "<hex size>\r\n<data>\r\n", up to a chunk of size 0
+    u8* read = body.begin;
+    u8* write = body.begin;
+    while (read < body.end) {
+        uptr size = 0;
+        for (; read < body.end && *read != '\r'; ++read) {
+            const u8 c = *read;
+            if (c >= '0' && c <= '9') {size = size * 16 + (uptr)(c - '0');}
+            else if (c >= 'a' && c <= 'f') {size = size * 16 + (uptr)(c - 'a' + 10);}
+            else if (c >= 'A' && c <= 'F') {size = size * 16 + (uptr)(c - 'A' + 10);}
+            else if (c == ';') {break;}
+        }
+        while (read < body.end && *read != '\n') {++read;}
+        read += read < body.end;
+        if (size == 0 || size > bytesize(read, body.end)) {
+            break;
+        }
+        sa_move(alloc, read, write, size);
+        write += size;
+        read += size + 2;
     }
+    body.end = write;
+    return body;
+}
 
-    // Find "text" after "output"
-    cur = pos_output + pat_output_len;
-    const u8* pos_text = end;
-    while (cur < end) {
-        if ((uptr)(end - cur) < pat_text_len) break;
-        uptr i = 0;
-        while (i < pat_text_len && cur[i] == pat_text[i]) ++i;
-        if (i == pat_text_len) { pos_text = cur; break; }
-        ++cur;
+// Text of the answer: the first "text" string inside the "output" array of the response
+static json_token find_answer(u8_slice body) {
+    json_tokenizer t;
+    json_tokenizer_init(&t, body.begin, body.end);
+    json_token token = json_next(&t);
+    if (token.type != JSON_TOKEN_OBJECT_BEGIN) {
+        return token;
     }
-    if (pos_text == end) {
-        return answer;
+    token = json_object_find(&t, STRING("output"));
+    if (token.type != JSON_TOKEN_ARRAY_BEGIN) {
+        return token;
     }
-
-    // Move to the value after "text": "...", allowing spaces
-    cur = pos_text + pat_text_len;
-    while (cur < end && *cur != ':') ++cur;
-    if (cur == end) return answer;
-    ++cur; // after ':'
-
-    // Skip whitespace
-    while (cur < end && (*cur == ' ' || *cur == '\t' || *cur == '\r' || *cur == '\n')) ++cur;
-    if (cur == end) return answer;
-
-    // Find opening quote of the JSON string value
-    while (cur < end && *cur != '"') ++cur;
-    if (cur == end) return answer;
-    ++cur; // move past opening quote
-
-    const u8* text_begin = cur;
-
-    // Find closing quote, handling escapes
-    while (cur < end) {
-        if (*cur == '\\') {
-            ++cur;
-            if (cur < end) ++cur; // skip escaped character
+    const u32 output_depth = t.depth - 1;
+    const string text = STR("text");
+    for (token = json_next(&t); token.type != JSON_TOKEN_ERROR && t.depth > output_depth; token = json_next(&t)) {
+        if (token.type != JSON_TOKEN_KEY) {
             continue;
         }
-        if (*cur == '"') {
-            break;
+        const u8 is_text = bytesize(token.text.begin, token.text.end) == bytesize(text.begin, text.end)
+            && __builtin_memcmp(token.text.begin, text.begin, bytesize(text.begin, text.end)) == 0;
+        token = json_next(&t);
+        if (is_text && token.type == JSON_TOKEN_STRING) {
+            return token;
         }
-        ++cur;
     }
-    if (cur == end) return answer;
-
-    answer.begin = (u8*)text_begin;
-    answer.end = (u8*)cur;
-
-    return answer;
+    return (json_token){JSON_TOKEN_ERROR, {0, 0}};
 }
 
 /* ------------------------- Agent request ------------------------- */
@@ -116,23 +112,9 @@ static u8_slice extract_answer(u8_slice api_output) {
 u8* agent_request(u8_slice user_content, string api_key, string model, string prompt_id, stack_alloc* alloc) {
     void* begin = alloc->cursor;
 
-    u8_slice user_content_formatted;
-    user_content_formatted.begin = format_user_content(user_content, alloc);
-    user_content_formatted.end = alloc->cursor;
-
-    // Build JSON body (was curl -d before)
-    const string json_tpl = STR(
-        "{"
-            "\"model\":\"%s\","
-            "\"prompt\":{"
-                "\"id\":\"%s\""
-            "},"
-            "\"input\":\"%s\""
-        "}"
-    );
-
+    const request_body request = {model, {prompt_id}, {user_content.begin, user_content.end}};
     string json_body;
-    json_body.begin = print_format_to_buffer(alloc, json_tpl, model, prompt_id, user_content_formatted);
+    json_body.begin = json_encode(alloc, &request_body_meta, &request);
     json_body.end = alloc->cursor;
     const uptr body_size = bytesize(json_body.begin, json_body.end);
 
@@ -146,7 +128,7 @@ u8* agent_request(u8_slice user_content, string api_key, string model, string pr
         "Content-Type: application/json\r\n"
         "Connection: close\r\n"
         "Authorization: Bearer %s\r\n"
-        "Content-Length: %u\r\n"
+        "Content-Length: %zu\r\n"
         "\r\n"
     );
 
@@ -181,10 +163,15 @@ u8* agent_request(u8_slice user_content, string api_key, string model, string pr
     // Move response to the beginning of the region used by this function
     sa_move_tail(alloc, response_begin, begin);
 
-    // Extract the answer
-    u8_slice answer = extract_answer((u8_slice){begin, alloc->cursor});
-    sa_move_tail(alloc, answer.begin, begin);
-    sa_free(alloc, byteoffset(begin, bytesize(answer.begin, answer.end)));
+    // Extract and decode the answer
+    const u8_slice body = response_body(alloc, (u8_slice){begin, alloc->cursor});
+    const json_token answer = find_answer(body);
+    if (answer.type != JSON_TOKEN_STRING) {
+        sa_free(alloc, begin);
+        return begin;
+    }
+    u8* answer_begin = json_unescape(alloc, answer.text);
+    sa_move_tail(alloc, answer_begin, begin);
 
     return begin;
 }
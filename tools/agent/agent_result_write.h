@@ -3,6 +3,6 @@
 
 #include "file.h"
 
-void agent_result_write(file_t file, stack_alloc* alloc, u8_slice agent_result);
+void agent_result_write(file_t file, u8_slice agent_result);
 
 #endif
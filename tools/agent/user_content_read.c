@@ -72,10 +72,11 @@ u8* user_content_read(stack_alloc* alloc, u8_slice file_content) {
                 const string file_open_template = STR("<file %s>\n");
                 const string file_close_template = STR("\n</file>\n");
                 print_format_to_buffer(alloc, file_open_template, (string){path_begin, path_end});
-                void* tmp;
-                file_read_all(file, &tmp, alloc);
-                print_format_to_buffer(alloc, file_close_template);
+                u8_slice included = file_map_readonly(file);
                 file_close(file);
+                sa_alloc_copy(alloc, included.begin, included.end);
+                file_unmap(included);
+                print_format_to_buffer(alloc, file_close_template);
             }
         } else {
             ++cur;
@@ -1,27 +1,35 @@
 #include "../../src/libs/assert.h"
 #include "../../src/libs/backtrace.h"
 #include "../../src/libs/convert.h"
+#include "../../src/libs/directory_walk.h"
 #include "../../src/libs/exec_command.h"
 #include "../../src/libs/file.h"
 #include "../../src/libs/format_iterator.h"
+#include "../../src/libs/hash_map.h"
+#include "../../src/libs/log.h"
 #include "../../src/libs/mem.h"
-#include "../../src/libs/meta_iterator.h"
+#include "../../src/libs/meta_plan.h"
 #include "../../src/libs/print.h"
 #include "../../src/libs/stack_alloc.h"
 #include "../../src/libs/system_time.h"
+#include "../../src/libs/thread.h"
 #include "../../src/libs/time.h"
 
 #include "../../src/libs/assert.c"
 #include "../../src/libs/backtrace.c"
 #include "../../src/libs/convert.c"
+#include "../../src/libs/directory_walk.c"
 #include "../../src/libs/exec_command.c"
 #include "../../src/libs/file.c"
 #include "../../src/libs/format_iterator.c"
+#include "../../src/libs/hash_map.c"
+#include "../../src/libs/log.c"
 #include "../../src/libs/mem.c"
-#include "../../src/libs/meta_iterator.c"
+#include "../../src/libs/meta_plan.c"
 #include "../../src/libs/print.c"
 #include "../../src/libs/stack_alloc.c"
 #include "../../src/libs/system_time.c"
+#include "../../src/libs/thread.c"
 #include "../../src/libs/time.c"
 
 #include "./minimake_script.h"
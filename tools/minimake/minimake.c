@@ -4,6 +4,7 @@
 #include "exec_command.h"
 #include "system_time.h"
 #include "print.h"
+#include "log.h"
 #include "minimake_script.h"
 
 typedef enum {
@@ -11,7 +12,7 @@ typedef enum {
   flavor_release,  
 } flavor;
 
-static targets make_targets(flavor flavor, string build_dir, exec_command_session* session, stack_alloc* alloc) {
+static targets make_targets(flavor flavor, string build_dir, stack_alloc* alloc) {
     targets targetss;
     targetss.begin = alloc->cursor;
 
@@ -52,14 +53,20 @@ static targets make_targets(flavor flavor, string build_dir, exec_command_sessio
     
     strings common_c_files = begin_strings(alloc);
     push_string(STRING("src/libs/assert.c"), alloc);
+    push_string(STRING("src/libs/async_io.c"), alloc);
     push_string(STRING("src/libs/backtrace.c"), alloc);
     push_string(STRING("src/libs/bit.c"), alloc);
     push_string(STRING("src/libs/convert.c"), alloc);
+    push_string(STRING("src/libs/directory_walk.c"), alloc);
     push_string(STRING("src/libs/exec_command.c"), alloc);
     push_string(STRING("src/libs/file.c"), alloc);
     push_string(STRING("src/libs/format_iterator.c"), alloc);
+    push_string(STRING("src/libs/hash_map.c"), alloc);
+    push_string(STRING("src/libs/json.c"), alloc);
+    push_string(STRING("src/libs/log.c"), alloc);
     push_string(STRING("src/libs/mem.c"), alloc);
-    push_string(STRING("src/libs/meta_iterator.c"), alloc);
+    push_string(STRING("src/libs/meta_plan.c"), alloc);
+    push_string(STRING("src/libs/meta_serialize.c"), alloc);
     push_string(STRING("src/libs/print.c"), alloc);
     push_string(STRING("src/libs/stack_alloc.c"), alloc);
     push_string(STRING("src/libs/system_time.c"), alloc);
@@ -97,7 +104,10 @@ static targets make_targets(flavor flavor, string build_dir, exec_command_sessio
 
     strings network_c_files = begin_strings(alloc);
     push_string(STRING("src/libs/network/tcp/tcp_connection.c"), alloc);
+    push_string(STRING("src/libs/network/tcp/tcp_reactor.c"), alloc);
     push_string(STRING("src/libs/network/tcp/tcp_read_write.c"), alloc);
+    push_string(STRING("src/libs/network/tcp/tcp_server.c"), alloc);
+    push_string(STRING("src/libs/network/tcp/tcp_stream.c"), alloc);
     push_string(STRING("src/libs/network/https/https_request.c"), alloc);
     end_strings(&network_c_files, alloc);
 
@@ -107,7 +117,8 @@ static targets make_targets(flavor flavor, string build_dir, exec_command_sessio
     // BEGIN - x11
     u8 use_x11 = 0;
     {
-        exec_command_result use_x11_result = command_session_exec_command(session, STRING("pkg-config --exists x11"), alloc);
+        const string pkg_config[] = {STR("pkg-config"), STR("--exists"), STR("x11")};
+        exec_command_result use_x11_result = exec_command_argv(pkg_config, pkg_config + 3, alloc);
         use_x11 = use_x11_result.success;
         sa_free(alloc, use_x11_result.output);
     }
@@ -281,13 +292,20 @@ static targets make_targets(flavor flavor, string build_dir, exec_command_sessio
     // BEGIN - tests
     strings tests_c_files = begin_strings(alloc);
     push_string(STRING("tests/all_tests.c"), alloc);
+    push_string(STRING("tests/test_async_io.c"), alloc);
     push_string(STRING("tests/test_backtrace.c"), alloc);
+    push_string(STRING("tests/test_convert.c"), alloc);
+    push_string(STRING("tests/test_directory_walk.c"), alloc);
     push_string(STRING("tests/test_exec_command.c"), alloc);
     push_string(STRING("tests/test_file.c"), alloc);
     push_string(STRING("tests/test_fps_ticker.c"), alloc);
     push_string(STRING("tests/test_framework.c"), alloc);
+    push_string(STRING("tests/test_hash_map.c"), alloc);
+    push_string(STRING("tests/test_json.c"), alloc);
+    push_string(STRING("tests/test_log.c"), alloc);
     push_string(STRING("tests/test_lzss.c"), alloc);
     push_string(STRING("tests/test_mem.c"), alloc);
+    push_string(STRING("tests/test_meta_serialize.c"), alloc);
     push_string(STRING("tests/test_network_https.c"), alloc);
     push_string(STRING("tests/test_network_tcp.c"), alloc);
     push_string(STRING("tests/test_print.c"), alloc);
@@ -377,6 +395,7 @@ i32 main(i32 argc, char** argv) {
     stack_alloc* alloc = &_alloc;
     sa_init(alloc, memory, (char*)memory + memory_size);
 
+    log_start(file_stdout());
     exec_command_session* session = open_persistent_shell(alloc);
 
     const string build_dir = STR("build/");
@@ -384,6 +403,8 @@ i32 main(i32 argc, char** argv) {
 
     directory_create(alloc, build_dir.begin, build_dir.end, DIR_MODE_PUBLIC);
     directory_create(alloc, cache_dir.begin, cache_dir.end, DIR_MODE_PUBLIC);
+    // Timestamps of an interrupted run that were not renamed yet
+    file_atomic_cleanup(alloc, cache_dir.begin, cache_dir.end);
 
     u64 target_begin_ms = sys_time_ms();
 
@@ -412,7 +433,7 @@ i32 main(i32 argc, char** argv) {
         }
     }
 
-    targets targetss = make_targets(flavor, build_dir, session, alloc);
+    targets targetss = make_targets(flavor, build_dir, alloc);
     
     u64 target_end_ms = sys_time_ms();
     const mem_bytesize_human_readable_values target_alloc_size = mem_bytesize_human_readable(alloc->begin, alloc->cursor);
@@ -466,11 +487,11 @@ i32 main(i32 argc, char** argv) {
 
     const mem_bytesize_human_readable_values total_size = mem_bytesize_human_readable(alloc->begin, alloc->end);
     u64 build_end_ms = sys_time_ms();
-    print_format(file_stdout(), STRING("Targets took: %ums. Memory: %uM %uK / %uM %uK.\n"), target_end_ms - target_begin_ms, 
+    LOG_INFO(STRING("Targets took: %llums. Memory: %zuM %zuK / %zuM %zuK."), target_end_ms - target_begin_ms, 
         target_alloc_size.mib, target_alloc_size.kib,
         total_size.mib, total_size.kib
     );
-    print_format(file_stdout(), STRING("Builds took: %ums.\n"), build_end_ms - build_begin_ms);
+    LOG_INFO(STRING("Builds took: %llums."), build_end_ms - build_begin_ms);
     
     sa_free(alloc, targetss.begin);
     close_persistent_shell(session);
@@ -478,5 +499,6 @@ i32 main(i32 argc, char** argv) {
     
     sa_deinit(alloc);
     mem_unmap(memory, memory_size);
+    log_stop();
     return return_code ? 0 : 1;
 }
@@ -236,22 +236,11 @@ targets create_c_object_targets(const string cc, const strings flags,
         // if dependency file available, parse it
         file_t dep_file = file_open(alloc, object_dependency->begin, object_dependency->end, FILE_MODE_READ);
         if (dep_file != file_invalid()) {
-            void* var_begin = alloc->cursor;
-            string dep_file_content;
-            file_read_all(dep_file, (void**)&dep_file_content.begin, alloc);
+            // Dependencies are parsed straight from the page cache, they are pushed as the target deps
+            u8_slice dep_file_content = file_map_readonly(dep_file);
             file_close(dep_file);
-            dep_file_content.end = alloc->cursor;
-            void* var_end = alloc->cursor;
-            string* dependencies = extract_c_dependencies(dep_file_content, alloc);
-            
-            sa_move_tail(alloc, var_end, var_begin);
-            const uptr offset = -bytesize(var_begin, var_end);
-            dependencies = var_begin;
-            for (string* d = dependencies; (void*)d<alloc->cursor;) {
-                d->begin = byteoffset(d->begin, offset);
-                d->end = byteoffset(d->end, offset);
-                d = (void*)d->end;
-            }
+            extract_c_dependencies((string){dep_file_content.begin, dep_file_content.end}, alloc);
+            file_unmap(dep_file_content);
         }
         finish_target(dependency_target, alloc);
 
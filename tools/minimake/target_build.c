@@ -2,17 +2,21 @@
 
 #include "target_execution_list.h"
 #include "print.h"
+#include "log.h"
 #include "target_timestamp.h"
+#include "directory_walk.h"
 
 u8 target_build_phony(target* t, u8 dry, exec_command_session* session, string cache_dir, stack_alloc* alloc) {
+    unused(t);
+    unused(dry);
     unused(session);
-    if (!dry) {
-        target_update_timestamp(t, cache_dir, alloc);
-    }
+    unused(cache_dir);
+    unused(alloc);
     return 1;
 }
 
 u8 target_build_object_dependencies(target* t, u8 dry, exec_command_session* session, string cache_dir, stack_alloc* alloc) {
+    unused(cache_dir);
     void* begin = alloc->cursor;
 
     const string template = {t->template, t->deps};
@@ -33,11 +37,12 @@ u8 target_build_object_dependencies(target* t, u8 dry, exec_command_session* ses
     command.begin = print_format_to_buffer(alloc, template, c_file, dep_file);
     command.end = alloc->cursor;
 
-    print_format(file_stdout(), STRING("%s\n"), command);
+    LOG_INFO(STRING("%s"), command);
 
     exec_command_result exec;
     if (!dry) {
         exec = command_session_exec_command(session, command, alloc);
+        LOG_DEBUG(STRING("%s took %llums, cpu %llums"), t->name, exec.usage.wall_us / 1000, (exec.usage.user_us + exec.usage.system_us) / 1000);
     } else {
         exec.output = alloc->cursor;
         exec.success = 1;
@@ -46,20 +51,21 @@ u8 target_build_object_dependencies(target* t, u8 dry, exec_command_session* ses
     log.begin = exec.output;
     log.end = alloc->cursor;
     if (log.begin != log.end) {
-        print_format(file_stdout(), STRING("%s\n"), log);
+        if (exec.success) {
+            LOG_WARN(STRING("%s"), log);
+        } else {
+            LOG_ERROR(STRING("%s"), log);
+        }
     }
     exec.output = 0;
 
     sa_free(alloc, begin);
 
-    if (exec.success && !dry) {
-        target_update_timestamp(t, cache_dir, alloc);
-    }
-
     return exec.success;
 }
 
 u8 target_build_object(target* t, u8 dry, exec_command_session* session, string cache_dir, stack_alloc* alloc) {
+    unused(cache_dir);
     void* begin = alloc->cursor;
     
     const string template = {t->template, t->deps};
@@ -80,11 +86,12 @@ u8 target_build_object(target* t, u8 dry, exec_command_session* session, string
     command.begin = print_format_to_buffer(alloc, template, c_file, t->name);
     command.end = alloc->cursor;
 
-    print_format(file_stdout(), STRING("%s\n"), command);
+    LOG_INFO(STRING("%s"), command);
 
     exec_command_result exec;
     if (!dry) {
         exec = command_session_exec_command(session, command, alloc);
+        LOG_DEBUG(STRING("%s took %llums, cpu %llums"), t->name, exec.usage.wall_us / 1000, (exec.usage.user_us + exec.usage.system_us) / 1000);
     } else {
         exec.output = alloc->cursor;
         exec.success = 1;
@@ -93,20 +100,21 @@ u8 target_build_object(target* t, u8 dry, exec_command_session* session, string
     log.begin = exec.output;
     log.end = alloc->cursor;
     if (log.begin != log.end) {
-        print_format(file_stdout(), STRING("%s\n"), log);
+        if (exec.success) {
+            LOG_WARN(STRING("%s"), log);
+        } else {
+            LOG_ERROR(STRING("%s"), log);
+        }
     }
     exec.output = 0;
     
     sa_free(alloc, begin);
 
-    if (exec.success && !dry) {
-        target_update_timestamp(t, cache_dir, alloc);
-    }
-
     return exec.success;
 }
 
 u8 target_build_executable(target* t, u8 dry, exec_command_session* session, string cache_dir, stack_alloc* alloc) {
+    unused(cache_dir);
     void* begin = alloc->cursor;
     
     const string template = {t->template, t->deps};
@@ -130,11 +138,12 @@ u8 target_build_executable(target* t, u8 dry, exec_command_session* session, str
     command.begin = print_format_to_buffer(alloc, template, deps_as_command, t->name);
     command.end = alloc->cursor;
 
-    print_format(file_stdout(), STRING("%s\n"), command);
+    LOG_INFO(STRING("%s"), command);
 
     exec_command_result exec;
     if (!dry) {
         exec = command_session_exec_command(session, command, alloc);
+        LOG_DEBUG(STRING("%s took %llums, cpu %llums"), t->name, exec.usage.wall_us / 1000, (exec.usage.user_us + exec.usage.system_us) / 1000);
     } else {
         exec.output = alloc->cursor;
         exec.success = 1;
@@ -143,23 +152,26 @@ u8 target_build_executable(target* t, u8 dry, exec_command_session* session, str
     log.begin = exec.output;
     log.end = alloc->cursor;
     if (log.begin != log.end) {
-        print_format(file_stdout(), STRING("%s\n"), log);
+        if (exec.success) {
+            LOG_WARN(STRING("%s"), log);
+        } else {
+            LOG_ERROR(STRING("%s"), log);
+        }
     }
     exec.output = 0;
     
     sa_free(alloc, begin);
 
-    if (exec.success && !dry) {
-        target_update_timestamp(t, cache_dir, alloc);
-    }
     return exec.success;
 }
 
 u8 target_build_extract(target* t, u8 dry, exec_command_session* session, string cache_dir, stack_alloc* alloc) {
+    unused(cache_dir);
     string output_directory;
     directory_parent(t->name.begin, t->name.end, (void*)&output_directory.begin, (void*)&output_directory.end);
     directory_parent(output_directory.begin, output_directory.end, (void*)&output_directory.begin, (void*)&output_directory.end);
-    directory_remove(alloc, output_directory.begin, output_directory.end);
+    // Extracted archives can hold large trees, remove them from several threads
+    directory_walk_remove(alloc, output_directory.begin, output_directory.end, 4);
     directory_create(alloc, output_directory.begin, output_directory.end, DIR_MODE_PUBLIC);
 
     string tar_gz_input_path = *t->deps;
@@ -188,7 +200,7 @@ u8 target_build_extract(target* t, u8 dry, exec_command_session* session, string
             exec.success = 1;
         }
         string output = {exec.output, alloc->cursor};
-        print_format(file_stdout(), STRING("%s"), output);
+        LOG_DEBUG(STRING("%s"), output);
         
         success = exec.success;
         sa_free(alloc, begin);
@@ -200,27 +212,22 @@ u8 target_build_extract(target* t, u8 dry, exec_command_session* session, string
         file_close(file);
     }
 
-    if (success && !dry) {
-        target_update_timestamp(t, cache_dir, alloc);
-    }
-
     return success;
 }
 
-static u8 target_should_build(target* t, string cache_dir, stack_alloc* alloc) {
+static u8 target_should_build(target* t, string cache_dir, file_metadata_cache* cache, stack_alloc* alloc) {
     if (t->deps == t->end) {
         return 1;
     }
 
-    uptr input_ts = timestamp_read(t->name, cache_dir, alloc);
+    uptr input_ts = timestamp_read_cached(t->name, cache_dir, cache, alloc);
     for (const string* d = t->deps; (void*)d < t->end;) {
         uptr dep_ts = 0;
-        file_t file = file_open(alloc, d->begin, d->end, FILE_MODE_READ);
-        if (file != file_invalid()) {
-            dep_ts = file_modification_time(file);
-            file_close(file);
+        const file_metadata dep = file_metadata_cached(cache, *d);
+        if (dep.exists) {
+            dep_ts = dep.modification_time;
         } else {
-            dep_ts = timestamp_read(*d, cache_dir, alloc);
+            dep_ts = timestamp_read_cached(*d, cache_dir, cache, alloc);
         }
     
         if (dep_ts > input_ts) {
@@ -241,6 +248,21 @@ u8 target_build(target* targets_begin, target* targets_end, target* target_to_bu
     execution_list.begin = target_execution_list(targets_begin, targets_end, target_to_build, alloc);
     execution_list.end = alloc->cursor;
 
+    // Headers are shared by many objects, each path is queried once per run.
+    // Capacity for every dependency, target and their timestamp file.
+    uptr path_count = 0;
+    for (target** target_pp = execution_list.begin; target_pp < execution_list.end; ++target_pp) {
+        for (const string* d = (*target_pp)->deps; (void*)d < (*target_pp)->end; d = d->end) {
+            path_count += 2;
+        }
+        path_count += 2;
+    }
+    file_metadata_cache* cache = file_metadata_cache_init(path_count);
+
+    // Timestamps written during the run share group commits, a few targets at a time
+    file_sync_batch batch;
+    file_sync_batch_init(&batch);
+
     for (target** target_pp = execution_list.end - 1; target_pp >= execution_list.begin; --target_pp) {
         target* t = *target_pp;
 
@@ -248,17 +270,30 @@ u8 target_build(target* targets_begin, target* targets_end, target* target_to_bu
         if (dry) {
             should_build = 1;
         } else {
-            should_build = target_should_build(t, cache_dir, alloc);
+            should_build = target_should_build(t, cache_dir, cache, alloc);
         }
         if (should_build) {
-             print_format(file_stdout(), STRING("%s\n"), t->name);
+            LOG_INFO(STRING("%s"), t->name);
             if (!t->build(t, dry, session, cache_dir, alloc)) {
                 success = 0;
                 break;
             }
+            if (!dry) {
+                // Batched timestamps are replaced at the next group commit, the ones standing in
+                // for outputs that are not files are read by later targets and written right away
+                file_metadata_cache_invalidate(cache, t->name);
+                const u8 output_is_file = file_metadata_cached(cache, t->name).exists;
+                target_update_timestamp(t, cache_dir, output_is_file ? &batch : 0, alloc);
+            }
+            // The target output and its timestamp have been written
+            file_metadata_cache_invalidate(cache, t->name);
+            timestamp_invalidate(t->name, cache_dir, cache, alloc);
         }
     }
 
+    file_sync_batch_commit(&batch);
+    file_metadata_cache_deinit(cache);
+
     sa_free(alloc, begin);
     return success;
 }
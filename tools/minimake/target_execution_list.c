@@ -1,21 +1,9 @@
 #include "primitive.h"
 #include "stack_alloc.h"
+#include "hash_map.h"
 #include "target_execution_list.h"
 #include "target.h"
 
-static target** find_last_target_with_same_name(target** targets_begin, target** targets_end, string name, stack_alloc* alloc) {
-    for (target** check = targets_begin; check < targets_end; ++check) {
-        target* existing = *check;
-        u8 same = sa_equals(alloc, existing->name.begin, existing->name.end,
-                 name.begin, name.end);
-        if (same) {
-            return check;
-        }
-    }
-
-    return 0;
-}
-
 target** target_execution_list(target* targets_begin, target* targets_end, target* main, stack_alloc* alloc) {
 
     /*
@@ -26,6 +14,25 @@ target** target_execution_list(target* targets_begin, target* targets_end, targe
         to begin executes dependencies first and the main target last.
     */
 
+    uptr target_count = 0;
+    for (target* t = targets_begin; t < targets_end; t = t->end) {
+        target_count += 1;
+    }
+
+    /* Index targets by name. The first target declared with a name wins. */
+    hash_map* targets_by_name = hash_map_init(alloc, HASH_MAP_KEY_STRING, target_count);
+    for (target* t = targets_begin; t < targets_end; t = t->end) {
+        u8 inserted;
+        uptr* value = hash_map_insert_string(targets_by_name, t->name, &inserted);
+        if (inserted) {
+            *value = (uptr)t;
+        }
+    }
+
+    /* Names already pushed to the list */
+    hash_map* listed = hash_map_init(alloc, HASH_MAP_KEY_STRING, target_count + 1);
+    hash_map_insert_string(listed, main->name, 0);
+
     /* Reserve the start of the list in the allocator and push 'main' */
     target** list_begin = alloc->cursor;
     target** first = sa_alloc(alloc, sizeof(*first));
@@ -40,18 +47,15 @@ target** target_execution_list(target* targets_begin, target* targets_end, targe
         for (string* d = cur->deps; (void*)d < cur->end; ) {
 
             /* Try to find a target whose name matches this dependency */
-            for (target* cand = targets_begin; cand < targets_end; cand = cand->end) {
-                if (sa_equals(alloc, cand->name.begin, cand->name.end, d->begin, d->end)) {
-                    /* Ensure uniqueness: check if cand is already in list by name */
-                    target** duplicate = find_last_target_with_same_name(list_begin, list_end, cand->name, alloc);
-                    if (!duplicate) {
-                        target** push = sa_alloc(alloc, sizeof(*push));
-                        *push = cand;
-                        list_end = alloc->cursor;
-                    }
-
-                    /* Found matching target, no need to check other candidates */
-                    break;
+            uptr* cand = hash_map_find_string(targets_by_name, *d);
+            if (cand) {
+                /* Ensure uniqueness: check if cand is already in list by name */
+                u8 inserted;
+                hash_map_insert_string(listed, ((target*)*cand)->name, &inserted);
+                if (inserted) {
+                    target** push = sa_alloc(alloc, sizeof(*push));
+                    *push = (target*)*cand;
+                    list_end = alloc->cursor;
                 }
             }
 
@@ -3,17 +3,18 @@
 #include "file.h"
 #include "target_timestamp.h"
 
-void timestamp_write(const string name, const string cache_dir, uptr ts, stack_alloc* alloc) {
+void timestamp_write(const string name, const string cache_dir, uptr ts, file_sync_batch* batch, stack_alloc* alloc) {
     string name_path;
     name_path.begin = sa_alloc_copy(alloc, cache_dir.begin, cache_dir.end);
     sa_alloc_copy(alloc, name.begin, name.end);
     name_path.end = alloc->cursor;
 
     directory_create_for_file(alloc, name_path.begin, name_path.end, DIR_MODE_PUBLIC);
-    file_t file = file_open(alloc, name_path.begin, name_path.end, FILE_MODE_WRITE);
-
-    file_write(file, &ts, (&ts) + 1);
-    file_close(file);
+    file_atomic* atomic = file_atomic_open(alloc, name_path.begin, name_path.end);
+    if (atomic) {
+        file_write(file_atomic_file(atomic), &ts, (&ts) + 1);
+        file_atomic_commit(alloc, atomic, batch);
+    }
 
     sa_free(alloc, (void*)name_path.begin);
 }
@@ -36,12 +37,36 @@ uptr timestamp_read(const string name, const string cache_dir, stack_alloc* allo
     return ts;
 }
 
-void target_update_timestamp(target* t, string cache_dir, stack_alloc* alloc) {
+uptr timestamp_read_cached(const string name, const string cache_dir, file_metadata_cache* cache, stack_alloc* alloc) {
+    string name_path;
+    name_path.begin = sa_alloc_copy(alloc, cache_dir.begin, cache_dir.end);
+    sa_alloc_copy(alloc, name.begin, name.end);
+    name_path.end = alloc->cursor;
+
+    const file_metadata metadata = file_metadata_cached(cache, name_path);
+
+    sa_free(alloc, (void*)name_path.begin);
+
+    return metadata.modification_time;
+}
+
+void timestamp_invalidate(const string name, const string cache_dir, file_metadata_cache* cache, stack_alloc* alloc) {
+    string name_path;
+    name_path.begin = sa_alloc_copy(alloc, cache_dir.begin, cache_dir.end);
+    sa_alloc_copy(alloc, name.begin, name.end);
+    name_path.end = alloc->cursor;
+
+    file_metadata_cache_invalidate(cache, name_path);
+
+    sa_free(alloc, (void*)name_path.begin);
+}
+
+void target_update_timestamp(target* t, string cache_dir, file_sync_batch* batch, stack_alloc* alloc) {
     uptr ts_to_write = 0;
     for (string* d = t->deps; (void*)d < t->end;) {
         uptr ts = timestamp_read(*d, cache_dir, alloc);
         if (ts > ts_to_write) {ts_to_write = ts;}
         d = (void*)d->end;
     }
-    timestamp_write(t->name, cache_dir, ts_to_write, alloc);
+    timestamp_write(t->name, cache_dir, ts_to_write, batch, alloc);
 }
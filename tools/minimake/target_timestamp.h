@@ -4,9 +4,14 @@
 #include "primitive.h"
 #include "stack_alloc.h"
 #include "target.h"
+#include "file.h"
 
-void timestamp_write(const string name, const string cache_dir, uptr ts, stack_alloc* alloc);
+// Replaces the timestamp file atomically, at the batch commit if batch is not 0
+void timestamp_write(const string name, const string cache_dir, uptr ts, file_sync_batch* batch, stack_alloc* alloc);
 uptr timestamp_read(const string name, const string cache_dir, stack_alloc* alloc);
-void target_update_timestamp(target* t, string cache_dir, stack_alloc* alloc);
+// Same as timestamp_read, served from the metadata cache
+uptr timestamp_read_cached(const string name, const string cache_dir, file_metadata_cache* cache, stack_alloc* alloc);
+void timestamp_invalidate(const string name, const string cache_dir, file_metadata_cache* cache, stack_alloc* alloc);
+void target_update_timestamp(target* t, string cache_dir, file_sync_batch* batch, stack_alloc* alloc);
 
 #endif // MINIMAKE_TARGET_TIMESTAMP_H